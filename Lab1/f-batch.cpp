@@ -0,0 +1,899 @@
+// Generated by 'generator --batch type-pairs.txt', do not edit
+#include "f-table.hpp"
+#include <cstdint>
+#include <iostream>
+
+int f_char_char() { 
+  char a = 2;
+  char b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_char_short() { 
+  char a = 2;
+  short b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_char_int() { 
+  char a = 2;
+  int b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_char_long() { 
+  char a = 2;
+  long b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_char_unsigned() { 
+  char a = 2;
+  unsigned b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_char_float() { 
+  char a = 2;
+  float b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_char_double() { 
+  char a = 2;
+  double b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_char_std__int64_t() { 
+  char a = 2;
+  std::int64_t b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_char_std__uint8_t() { 
+  char a = 2;
+  std::uint8_t b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_short_char() { 
+  short a = 2;
+  char b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_short_short() { 
+  short a = 2;
+  short b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_short_int() { 
+  short a = 2;
+  int b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_short_long() { 
+  short a = 2;
+  long b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_short_unsigned() { 
+  short a = 2;
+  unsigned b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_short_float() { 
+  short a = 2;
+  float b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_short_double() { 
+  short a = 2;
+  double b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_short_std__int64_t() { 
+  short a = 2;
+  std::int64_t b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_short_std__uint8_t() { 
+  short a = 2;
+  std::uint8_t b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_int_char() { 
+  int a = 2;
+  char b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_int_short() { 
+  int a = 2;
+  short b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_int_int() { 
+  int a = 2;
+  int b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_int_long() { 
+  int a = 2;
+  long b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_int_unsigned() { 
+  int a = 2;
+  unsigned b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_int_float() { 
+  int a = 2;
+  float b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_int_double() { 
+  int a = 2;
+  double b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_int_std__int64_t() { 
+  int a = 2;
+  std::int64_t b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_int_std__uint8_t() { 
+  int a = 2;
+  std::uint8_t b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_long_char() { 
+  long a = 2;
+  char b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_long_short() { 
+  long a = 2;
+  short b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_long_int() { 
+  long a = 2;
+  int b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_long_long() { 
+  long a = 2;
+  long b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_long_unsigned() { 
+  long a = 2;
+  unsigned b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_long_float() { 
+  long a = 2;
+  float b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_long_double() { 
+  long a = 2;
+  double b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_long_std__int64_t() { 
+  long a = 2;
+  std::int64_t b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_long_std__uint8_t() { 
+  long a = 2;
+  std::uint8_t b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_unsigned_char() { 
+  unsigned a = 2;
+  char b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_unsigned_short() { 
+  unsigned a = 2;
+  short b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_unsigned_int() { 
+  unsigned a = 2;
+  int b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_unsigned_long() { 
+  unsigned a = 2;
+  long b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_unsigned_unsigned() { 
+  unsigned a = 2;
+  unsigned b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_unsigned_float() { 
+  unsigned a = 2;
+  float b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_unsigned_double() { 
+  unsigned a = 2;
+  double b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_unsigned_std__int64_t() { 
+  unsigned a = 2;
+  std::int64_t b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_unsigned_std__uint8_t() { 
+  unsigned a = 2;
+  std::uint8_t b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_float_char() { 
+  float a = 2;
+  char b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_float_short() { 
+  float a = 2;
+  short b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_float_int() { 
+  float a = 2;
+  int b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_float_long() { 
+  float a = 2;
+  long b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_float_unsigned() { 
+  float a = 2;
+  unsigned b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_float_float() { 
+  float a = 2;
+  float b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_float_double() { 
+  float a = 2;
+  double b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_float_std__int64_t() { 
+  float a = 2;
+  std::int64_t b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_float_std__uint8_t() { 
+  float a = 2;
+  std::uint8_t b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_double_char() { 
+  double a = 2;
+  char b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_double_short() { 
+  double a = 2;
+  short b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_double_int() { 
+  double a = 2;
+  int b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_double_long() { 
+  double a = 2;
+  long b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_double_unsigned() { 
+  double a = 2;
+  unsigned b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_double_float() { 
+  double a = 2;
+  float b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_double_double() { 
+  double a = 2;
+  double b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_double_std__int64_t() { 
+  double a = 2;
+  std::int64_t b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_double_std__uint8_t() { 
+  double a = 2;
+  std::uint8_t b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_std__int64_t_char() { 
+  std::int64_t a = 2;
+  char b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_std__int64_t_short() { 
+  std::int64_t a = 2;
+  short b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_std__int64_t_int() { 
+  std::int64_t a = 2;
+  int b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_std__int64_t_long() { 
+  std::int64_t a = 2;
+  long b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_std__int64_t_unsigned() { 
+  std::int64_t a = 2;
+  unsigned b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_std__int64_t_float() { 
+  std::int64_t a = 2;
+  float b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_std__int64_t_double() { 
+  std::int64_t a = 2;
+  double b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_std__int64_t_std__int64_t() { 
+  std::int64_t a = 2;
+  std::int64_t b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_std__int64_t_std__uint8_t() { 
+  std::int64_t a = 2;
+  std::uint8_t b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_std__uint8_t_char() { 
+  std::uint8_t a = 2;
+  char b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_std__uint8_t_short() { 
+  std::uint8_t a = 2;
+  short b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_std__uint8_t_int() { 
+  std::uint8_t a = 2;
+  int b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_std__uint8_t_long() { 
+  std::uint8_t a = 2;
+  long b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_std__uint8_t_unsigned() { 
+  std::uint8_t a = 2;
+  unsigned b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_std__uint8_t_float() { 
+  std::uint8_t a = 2;
+  float b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_std__uint8_t_double() { 
+  std::uint8_t a = 2;
+  double b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_std__uint8_t_std__int64_t() { 
+  std::uint8_t a = 2;
+  std::int64_t b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+int f_std__uint8_t_std__uint8_t() { 
+  std::uint8_t a = 2;
+  std::uint8_t b{ 3 };
+  std::cout << a + b << "\n"; 
+  std::cout << a - b << "\n"; 
+  std::cout << a * b << "\n"; 
+  std::cout << a / b << "\n"; 
+  return 0;
+}
+
+const FEntry fTable[] = {
+  { "char", "char", f_char_char },
+  { "char", "short", f_char_short },
+  { "char", "int", f_char_int },
+  { "char", "long", f_char_long },
+  { "char", "unsigned", f_char_unsigned },
+  { "char", "float", f_char_float },
+  { "char", "double", f_char_double },
+  { "char", "std::int64_t", f_char_std__int64_t },
+  { "char", "std::uint8_t", f_char_std__uint8_t },
+  { "short", "char", f_short_char },
+  { "short", "short", f_short_short },
+  { "short", "int", f_short_int },
+  { "short", "long", f_short_long },
+  { "short", "unsigned", f_short_unsigned },
+  { "short", "float", f_short_float },
+  { "short", "double", f_short_double },
+  { "short", "std::int64_t", f_short_std__int64_t },
+  { "short", "std::uint8_t", f_short_std__uint8_t },
+  { "int", "char", f_int_char },
+  { "int", "short", f_int_short },
+  { "int", "int", f_int_int },
+  { "int", "long", f_int_long },
+  { "int", "unsigned", f_int_unsigned },
+  { "int", "float", f_int_float },
+  { "int", "double", f_int_double },
+  { "int", "std::int64_t", f_int_std__int64_t },
+  { "int", "std::uint8_t", f_int_std__uint8_t },
+  { "long", "char", f_long_char },
+  { "long", "short", f_long_short },
+  { "long", "int", f_long_int },
+  { "long", "long", f_long_long },
+  { "long", "unsigned", f_long_unsigned },
+  { "long", "float", f_long_float },
+  { "long", "double", f_long_double },
+  { "long", "std::int64_t", f_long_std__int64_t },
+  { "long", "std::uint8_t", f_long_std__uint8_t },
+  { "unsigned", "char", f_unsigned_char },
+  { "unsigned", "short", f_unsigned_short },
+  { "unsigned", "int", f_unsigned_int },
+  { "unsigned", "long", f_unsigned_long },
+  { "unsigned", "unsigned", f_unsigned_unsigned },
+  { "unsigned", "float", f_unsigned_float },
+  { "unsigned", "double", f_unsigned_double },
+  { "unsigned", "std::int64_t", f_unsigned_std__int64_t },
+  { "unsigned", "std::uint8_t", f_unsigned_std__uint8_t },
+  { "float", "char", f_float_char },
+  { "float", "short", f_float_short },
+  { "float", "int", f_float_int },
+  { "float", "long", f_float_long },
+  { "float", "unsigned", f_float_unsigned },
+  { "float", "float", f_float_float },
+  { "float", "double", f_float_double },
+  { "float", "std::int64_t", f_float_std__int64_t },
+  { "float", "std::uint8_t", f_float_std__uint8_t },
+  { "double", "char", f_double_char },
+  { "double", "short", f_double_short },
+  { "double", "int", f_double_int },
+  { "double", "long", f_double_long },
+  { "double", "unsigned", f_double_unsigned },
+  { "double", "float", f_double_float },
+  { "double", "double", f_double_double },
+  { "double", "std::int64_t", f_double_std__int64_t },
+  { "double", "std::uint8_t", f_double_std__uint8_t },
+  { "std::int64_t", "char", f_std__int64_t_char },
+  { "std::int64_t", "short", f_std__int64_t_short },
+  { "std::int64_t", "int", f_std__int64_t_int },
+  { "std::int64_t", "long", f_std__int64_t_long },
+  { "std::int64_t", "unsigned", f_std__int64_t_unsigned },
+  { "std::int64_t", "float", f_std__int64_t_float },
+  { "std::int64_t", "double", f_std__int64_t_double },
+  { "std::int64_t", "std::int64_t", f_std__int64_t_std__int64_t },
+  { "std::int64_t", "std::uint8_t", f_std__int64_t_std__uint8_t },
+  { "std::uint8_t", "char", f_std__uint8_t_char },
+  { "std::uint8_t", "short", f_std__uint8_t_short },
+  { "std::uint8_t", "int", f_std__uint8_t_int },
+  { "std::uint8_t", "long", f_std__uint8_t_long },
+  { "std::uint8_t", "unsigned", f_std__uint8_t_unsigned },
+  { "std::uint8_t", "float", f_std__uint8_t_float },
+  { "std::uint8_t", "double", f_std__uint8_t_double },
+  { "std::uint8_t", "std::int64_t", f_std__uint8_t_std__int64_t },
+  { "std::uint8_t", "std::uint8_t", f_std__uint8_t_std__uint8_t },
+};
+const std::size_t fTableSize = 81;
@@ -0,0 +1,2601 @@
+// Generated by 'generator --kernels type-pairs.txt', do not edit
+#include "kernel-harness.hpp"
+#include <cstdint>
+#include <utility>
+
+void kernel_char_char_plus(const char* __restrict a, const char* __restrict b,
+  decltype(std::declval<char>() + std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_char_char_minus(const char* __restrict a, const char* __restrict b,
+  decltype(std::declval<char>() - std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_char_char_mul(const char* __restrict a, const char* __restrict b,
+  decltype(std::declval<char>() * std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_char_char_div(const char* __restrict a, const char* __restrict b,
+  decltype(std::declval<char>() / std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_char_short_plus(const char* __restrict a, const short* __restrict b,
+  decltype(std::declval<char>() + std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_char_short_minus(const char* __restrict a, const short* __restrict b,
+  decltype(std::declval<char>() - std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_char_short_mul(const char* __restrict a, const short* __restrict b,
+  decltype(std::declval<char>() * std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_char_short_div(const char* __restrict a, const short* __restrict b,
+  decltype(std::declval<char>() / std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_char_int_plus(const char* __restrict a, const int* __restrict b,
+  decltype(std::declval<char>() + std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_char_int_minus(const char* __restrict a, const int* __restrict b,
+  decltype(std::declval<char>() - std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_char_int_mul(const char* __restrict a, const int* __restrict b,
+  decltype(std::declval<char>() * std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_char_int_div(const char* __restrict a, const int* __restrict b,
+  decltype(std::declval<char>() / std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_char_long_plus(const char* __restrict a, const long* __restrict b,
+  decltype(std::declval<char>() + std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_char_long_minus(const char* __restrict a, const long* __restrict b,
+  decltype(std::declval<char>() - std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_char_long_mul(const char* __restrict a, const long* __restrict b,
+  decltype(std::declval<char>() * std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_char_long_div(const char* __restrict a, const long* __restrict b,
+  decltype(std::declval<char>() / std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_char_unsigned_plus(const char* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<char>() + std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_char_unsigned_minus(const char* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<char>() - std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_char_unsigned_mul(const char* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<char>() * std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_char_unsigned_div(const char* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<char>() / std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_char_float_plus(const char* __restrict a, const float* __restrict b,
+  decltype(std::declval<char>() + std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_char_float_minus(const char* __restrict a, const float* __restrict b,
+  decltype(std::declval<char>() - std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_char_float_mul(const char* __restrict a, const float* __restrict b,
+  decltype(std::declval<char>() * std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_char_float_div(const char* __restrict a, const float* __restrict b,
+  decltype(std::declval<char>() / std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_char_double_plus(const char* __restrict a, const double* __restrict b,
+  decltype(std::declval<char>() + std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_char_double_minus(const char* __restrict a, const double* __restrict b,
+  decltype(std::declval<char>() - std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_char_double_mul(const char* __restrict a, const double* __restrict b,
+  decltype(std::declval<char>() * std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_char_double_div(const char* __restrict a, const double* __restrict b,
+  decltype(std::declval<char>() / std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_char_std__int64_t_plus(const char* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<char>() + std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_char_std__int64_t_minus(const char* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<char>() - std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_char_std__int64_t_mul(const char* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<char>() * std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_char_std__int64_t_div(const char* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<char>() / std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_char_std__uint8_t_plus(const char* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<char>() + std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_char_std__uint8_t_minus(const char* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<char>() - std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_char_std__uint8_t_mul(const char* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<char>() * std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_char_std__uint8_t_div(const char* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<char>() / std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_short_char_plus(const short* __restrict a, const char* __restrict b,
+  decltype(std::declval<short>() + std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_short_char_minus(const short* __restrict a, const char* __restrict b,
+  decltype(std::declval<short>() - std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_short_char_mul(const short* __restrict a, const char* __restrict b,
+  decltype(std::declval<short>() * std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_short_char_div(const short* __restrict a, const char* __restrict b,
+  decltype(std::declval<short>() / std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_short_short_plus(const short* __restrict a, const short* __restrict b,
+  decltype(std::declval<short>() + std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_short_short_minus(const short* __restrict a, const short* __restrict b,
+  decltype(std::declval<short>() - std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_short_short_mul(const short* __restrict a, const short* __restrict b,
+  decltype(std::declval<short>() * std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_short_short_div(const short* __restrict a, const short* __restrict b,
+  decltype(std::declval<short>() / std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_short_int_plus(const short* __restrict a, const int* __restrict b,
+  decltype(std::declval<short>() + std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_short_int_minus(const short* __restrict a, const int* __restrict b,
+  decltype(std::declval<short>() - std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_short_int_mul(const short* __restrict a, const int* __restrict b,
+  decltype(std::declval<short>() * std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_short_int_div(const short* __restrict a, const int* __restrict b,
+  decltype(std::declval<short>() / std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_short_long_plus(const short* __restrict a, const long* __restrict b,
+  decltype(std::declval<short>() + std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_short_long_minus(const short* __restrict a, const long* __restrict b,
+  decltype(std::declval<short>() - std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_short_long_mul(const short* __restrict a, const long* __restrict b,
+  decltype(std::declval<short>() * std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_short_long_div(const short* __restrict a, const long* __restrict b,
+  decltype(std::declval<short>() / std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_short_unsigned_plus(const short* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<short>() + std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_short_unsigned_minus(const short* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<short>() - std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_short_unsigned_mul(const short* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<short>() * std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_short_unsigned_div(const short* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<short>() / std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_short_float_plus(const short* __restrict a, const float* __restrict b,
+  decltype(std::declval<short>() + std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_short_float_minus(const short* __restrict a, const float* __restrict b,
+  decltype(std::declval<short>() - std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_short_float_mul(const short* __restrict a, const float* __restrict b,
+  decltype(std::declval<short>() * std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_short_float_div(const short* __restrict a, const float* __restrict b,
+  decltype(std::declval<short>() / std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_short_double_plus(const short* __restrict a, const double* __restrict b,
+  decltype(std::declval<short>() + std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_short_double_minus(const short* __restrict a, const double* __restrict b,
+  decltype(std::declval<short>() - std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_short_double_mul(const short* __restrict a, const double* __restrict b,
+  decltype(std::declval<short>() * std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_short_double_div(const short* __restrict a, const double* __restrict b,
+  decltype(std::declval<short>() / std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_short_std__int64_t_plus(const short* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<short>() + std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_short_std__int64_t_minus(const short* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<short>() - std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_short_std__int64_t_mul(const short* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<short>() * std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_short_std__int64_t_div(const short* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<short>() / std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_short_std__uint8_t_plus(const short* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<short>() + std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_short_std__uint8_t_minus(const short* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<short>() - std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_short_std__uint8_t_mul(const short* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<short>() * std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_short_std__uint8_t_div(const short* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<short>() / std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_int_char_plus(const int* __restrict a, const char* __restrict b,
+  decltype(std::declval<int>() + std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_int_char_minus(const int* __restrict a, const char* __restrict b,
+  decltype(std::declval<int>() - std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_int_char_mul(const int* __restrict a, const char* __restrict b,
+  decltype(std::declval<int>() * std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_int_char_div(const int* __restrict a, const char* __restrict b,
+  decltype(std::declval<int>() / std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_int_short_plus(const int* __restrict a, const short* __restrict b,
+  decltype(std::declval<int>() + std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_int_short_minus(const int* __restrict a, const short* __restrict b,
+  decltype(std::declval<int>() - std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_int_short_mul(const int* __restrict a, const short* __restrict b,
+  decltype(std::declval<int>() * std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_int_short_div(const int* __restrict a, const short* __restrict b,
+  decltype(std::declval<int>() / std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_int_int_plus(const int* __restrict a, const int* __restrict b,
+  decltype(std::declval<int>() + std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_int_int_minus(const int* __restrict a, const int* __restrict b,
+  decltype(std::declval<int>() - std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_int_int_mul(const int* __restrict a, const int* __restrict b,
+  decltype(std::declval<int>() * std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_int_int_div(const int* __restrict a, const int* __restrict b,
+  decltype(std::declval<int>() / std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_int_long_plus(const int* __restrict a, const long* __restrict b,
+  decltype(std::declval<int>() + std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_int_long_minus(const int* __restrict a, const long* __restrict b,
+  decltype(std::declval<int>() - std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_int_long_mul(const int* __restrict a, const long* __restrict b,
+  decltype(std::declval<int>() * std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_int_long_div(const int* __restrict a, const long* __restrict b,
+  decltype(std::declval<int>() / std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_int_unsigned_plus(const int* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<int>() + std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_int_unsigned_minus(const int* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<int>() - std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_int_unsigned_mul(const int* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<int>() * std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_int_unsigned_div(const int* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<int>() / std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_int_float_plus(const int* __restrict a, const float* __restrict b,
+  decltype(std::declval<int>() + std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_int_float_minus(const int* __restrict a, const float* __restrict b,
+  decltype(std::declval<int>() - std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_int_float_mul(const int* __restrict a, const float* __restrict b,
+  decltype(std::declval<int>() * std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_int_float_div(const int* __restrict a, const float* __restrict b,
+  decltype(std::declval<int>() / std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_int_double_plus(const int* __restrict a, const double* __restrict b,
+  decltype(std::declval<int>() + std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_int_double_minus(const int* __restrict a, const double* __restrict b,
+  decltype(std::declval<int>() - std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_int_double_mul(const int* __restrict a, const double* __restrict b,
+  decltype(std::declval<int>() * std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_int_double_div(const int* __restrict a, const double* __restrict b,
+  decltype(std::declval<int>() / std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_int_std__int64_t_plus(const int* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<int>() + std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_int_std__int64_t_minus(const int* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<int>() - std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_int_std__int64_t_mul(const int* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<int>() * std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_int_std__int64_t_div(const int* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<int>() / std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_int_std__uint8_t_plus(const int* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<int>() + std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_int_std__uint8_t_minus(const int* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<int>() - std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_int_std__uint8_t_mul(const int* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<int>() * std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_int_std__uint8_t_div(const int* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<int>() / std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_long_char_plus(const long* __restrict a, const char* __restrict b,
+  decltype(std::declval<long>() + std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_long_char_minus(const long* __restrict a, const char* __restrict b,
+  decltype(std::declval<long>() - std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_long_char_mul(const long* __restrict a, const char* __restrict b,
+  decltype(std::declval<long>() * std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_long_char_div(const long* __restrict a, const char* __restrict b,
+  decltype(std::declval<long>() / std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_long_short_plus(const long* __restrict a, const short* __restrict b,
+  decltype(std::declval<long>() + std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_long_short_minus(const long* __restrict a, const short* __restrict b,
+  decltype(std::declval<long>() - std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_long_short_mul(const long* __restrict a, const short* __restrict b,
+  decltype(std::declval<long>() * std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_long_short_div(const long* __restrict a, const short* __restrict b,
+  decltype(std::declval<long>() / std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_long_int_plus(const long* __restrict a, const int* __restrict b,
+  decltype(std::declval<long>() + std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_long_int_minus(const long* __restrict a, const int* __restrict b,
+  decltype(std::declval<long>() - std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_long_int_mul(const long* __restrict a, const int* __restrict b,
+  decltype(std::declval<long>() * std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_long_int_div(const long* __restrict a, const int* __restrict b,
+  decltype(std::declval<long>() / std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_long_long_plus(const long* __restrict a, const long* __restrict b,
+  decltype(std::declval<long>() + std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_long_long_minus(const long* __restrict a, const long* __restrict b,
+  decltype(std::declval<long>() - std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_long_long_mul(const long* __restrict a, const long* __restrict b,
+  decltype(std::declval<long>() * std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_long_long_div(const long* __restrict a, const long* __restrict b,
+  decltype(std::declval<long>() / std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_long_unsigned_plus(const long* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<long>() + std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_long_unsigned_minus(const long* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<long>() - std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_long_unsigned_mul(const long* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<long>() * std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_long_unsigned_div(const long* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<long>() / std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_long_float_plus(const long* __restrict a, const float* __restrict b,
+  decltype(std::declval<long>() + std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_long_float_minus(const long* __restrict a, const float* __restrict b,
+  decltype(std::declval<long>() - std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_long_float_mul(const long* __restrict a, const float* __restrict b,
+  decltype(std::declval<long>() * std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_long_float_div(const long* __restrict a, const float* __restrict b,
+  decltype(std::declval<long>() / std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_long_double_plus(const long* __restrict a, const double* __restrict b,
+  decltype(std::declval<long>() + std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_long_double_minus(const long* __restrict a, const double* __restrict b,
+  decltype(std::declval<long>() - std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_long_double_mul(const long* __restrict a, const double* __restrict b,
+  decltype(std::declval<long>() * std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_long_double_div(const long* __restrict a, const double* __restrict b,
+  decltype(std::declval<long>() / std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_long_std__int64_t_plus(const long* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<long>() + std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_long_std__int64_t_minus(const long* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<long>() - std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_long_std__int64_t_mul(const long* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<long>() * std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_long_std__int64_t_div(const long* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<long>() / std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_long_std__uint8_t_plus(const long* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<long>() + std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_long_std__uint8_t_minus(const long* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<long>() - std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_long_std__uint8_t_mul(const long* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<long>() * std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_long_std__uint8_t_div(const long* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<long>() / std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_unsigned_char_plus(const unsigned* __restrict a, const char* __restrict b,
+  decltype(std::declval<unsigned>() + std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_unsigned_char_minus(const unsigned* __restrict a, const char* __restrict b,
+  decltype(std::declval<unsigned>() - std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_unsigned_char_mul(const unsigned* __restrict a, const char* __restrict b,
+  decltype(std::declval<unsigned>() * std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_unsigned_char_div(const unsigned* __restrict a, const char* __restrict b,
+  decltype(std::declval<unsigned>() / std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_unsigned_short_plus(const unsigned* __restrict a, const short* __restrict b,
+  decltype(std::declval<unsigned>() + std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_unsigned_short_minus(const unsigned* __restrict a, const short* __restrict b,
+  decltype(std::declval<unsigned>() - std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_unsigned_short_mul(const unsigned* __restrict a, const short* __restrict b,
+  decltype(std::declval<unsigned>() * std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_unsigned_short_div(const unsigned* __restrict a, const short* __restrict b,
+  decltype(std::declval<unsigned>() / std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_unsigned_int_plus(const unsigned* __restrict a, const int* __restrict b,
+  decltype(std::declval<unsigned>() + std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_unsigned_int_minus(const unsigned* __restrict a, const int* __restrict b,
+  decltype(std::declval<unsigned>() - std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_unsigned_int_mul(const unsigned* __restrict a, const int* __restrict b,
+  decltype(std::declval<unsigned>() * std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_unsigned_int_div(const unsigned* __restrict a, const int* __restrict b,
+  decltype(std::declval<unsigned>() / std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_unsigned_long_plus(const unsigned* __restrict a, const long* __restrict b,
+  decltype(std::declval<unsigned>() + std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_unsigned_long_minus(const unsigned* __restrict a, const long* __restrict b,
+  decltype(std::declval<unsigned>() - std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_unsigned_long_mul(const unsigned* __restrict a, const long* __restrict b,
+  decltype(std::declval<unsigned>() * std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_unsigned_long_div(const unsigned* __restrict a, const long* __restrict b,
+  decltype(std::declval<unsigned>() / std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_unsigned_unsigned_plus(const unsigned* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<unsigned>() + std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_unsigned_unsigned_minus(const unsigned* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<unsigned>() - std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_unsigned_unsigned_mul(const unsigned* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<unsigned>() * std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_unsigned_unsigned_div(const unsigned* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<unsigned>() / std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_unsigned_float_plus(const unsigned* __restrict a, const float* __restrict b,
+  decltype(std::declval<unsigned>() + std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_unsigned_float_minus(const unsigned* __restrict a, const float* __restrict b,
+  decltype(std::declval<unsigned>() - std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_unsigned_float_mul(const unsigned* __restrict a, const float* __restrict b,
+  decltype(std::declval<unsigned>() * std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_unsigned_float_div(const unsigned* __restrict a, const float* __restrict b,
+  decltype(std::declval<unsigned>() / std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_unsigned_double_plus(const unsigned* __restrict a, const double* __restrict b,
+  decltype(std::declval<unsigned>() + std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_unsigned_double_minus(const unsigned* __restrict a, const double* __restrict b,
+  decltype(std::declval<unsigned>() - std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_unsigned_double_mul(const unsigned* __restrict a, const double* __restrict b,
+  decltype(std::declval<unsigned>() * std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_unsigned_double_div(const unsigned* __restrict a, const double* __restrict b,
+  decltype(std::declval<unsigned>() / std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_unsigned_std__int64_t_plus(const unsigned* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<unsigned>() + std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_unsigned_std__int64_t_minus(const unsigned* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<unsigned>() - std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_unsigned_std__int64_t_mul(const unsigned* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<unsigned>() * std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_unsigned_std__int64_t_div(const unsigned* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<unsigned>() / std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_unsigned_std__uint8_t_plus(const unsigned* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<unsigned>() + std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_unsigned_std__uint8_t_minus(const unsigned* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<unsigned>() - std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_unsigned_std__uint8_t_mul(const unsigned* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<unsigned>() * std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_unsigned_std__uint8_t_div(const unsigned* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<unsigned>() / std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_float_char_plus(const float* __restrict a, const char* __restrict b,
+  decltype(std::declval<float>() + std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_float_char_minus(const float* __restrict a, const char* __restrict b,
+  decltype(std::declval<float>() - std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_float_char_mul(const float* __restrict a, const char* __restrict b,
+  decltype(std::declval<float>() * std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_float_char_div(const float* __restrict a, const char* __restrict b,
+  decltype(std::declval<float>() / std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_float_short_plus(const float* __restrict a, const short* __restrict b,
+  decltype(std::declval<float>() + std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_float_short_minus(const float* __restrict a, const short* __restrict b,
+  decltype(std::declval<float>() - std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_float_short_mul(const float* __restrict a, const short* __restrict b,
+  decltype(std::declval<float>() * std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_float_short_div(const float* __restrict a, const short* __restrict b,
+  decltype(std::declval<float>() / std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_float_int_plus(const float* __restrict a, const int* __restrict b,
+  decltype(std::declval<float>() + std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_float_int_minus(const float* __restrict a, const int* __restrict b,
+  decltype(std::declval<float>() - std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_float_int_mul(const float* __restrict a, const int* __restrict b,
+  decltype(std::declval<float>() * std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_float_int_div(const float* __restrict a, const int* __restrict b,
+  decltype(std::declval<float>() / std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_float_long_plus(const float* __restrict a, const long* __restrict b,
+  decltype(std::declval<float>() + std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_float_long_minus(const float* __restrict a, const long* __restrict b,
+  decltype(std::declval<float>() - std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_float_long_mul(const float* __restrict a, const long* __restrict b,
+  decltype(std::declval<float>() * std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_float_long_div(const float* __restrict a, const long* __restrict b,
+  decltype(std::declval<float>() / std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_float_unsigned_plus(const float* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<float>() + std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_float_unsigned_minus(const float* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<float>() - std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_float_unsigned_mul(const float* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<float>() * std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_float_unsigned_div(const float* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<float>() / std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_float_float_plus(const float* __restrict a, const float* __restrict b,
+  decltype(std::declval<float>() + std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_float_float_minus(const float* __restrict a, const float* __restrict b,
+  decltype(std::declval<float>() - std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_float_float_mul(const float* __restrict a, const float* __restrict b,
+  decltype(std::declval<float>() * std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_float_float_div(const float* __restrict a, const float* __restrict b,
+  decltype(std::declval<float>() / std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_float_double_plus(const float* __restrict a, const double* __restrict b,
+  decltype(std::declval<float>() + std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_float_double_minus(const float* __restrict a, const double* __restrict b,
+  decltype(std::declval<float>() - std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_float_double_mul(const float* __restrict a, const double* __restrict b,
+  decltype(std::declval<float>() * std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_float_double_div(const float* __restrict a, const double* __restrict b,
+  decltype(std::declval<float>() / std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_float_std__int64_t_plus(const float* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<float>() + std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_float_std__int64_t_minus(const float* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<float>() - std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_float_std__int64_t_mul(const float* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<float>() * std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_float_std__int64_t_div(const float* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<float>() / std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_float_std__uint8_t_plus(const float* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<float>() + std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_float_std__uint8_t_minus(const float* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<float>() - std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_float_std__uint8_t_mul(const float* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<float>() * std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_float_std__uint8_t_div(const float* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<float>() / std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_double_char_plus(const double* __restrict a, const char* __restrict b,
+  decltype(std::declval<double>() + std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_double_char_minus(const double* __restrict a, const char* __restrict b,
+  decltype(std::declval<double>() - std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_double_char_mul(const double* __restrict a, const char* __restrict b,
+  decltype(std::declval<double>() * std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_double_char_div(const double* __restrict a, const char* __restrict b,
+  decltype(std::declval<double>() / std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_double_short_plus(const double* __restrict a, const short* __restrict b,
+  decltype(std::declval<double>() + std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_double_short_minus(const double* __restrict a, const short* __restrict b,
+  decltype(std::declval<double>() - std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_double_short_mul(const double* __restrict a, const short* __restrict b,
+  decltype(std::declval<double>() * std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_double_short_div(const double* __restrict a, const short* __restrict b,
+  decltype(std::declval<double>() / std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_double_int_plus(const double* __restrict a, const int* __restrict b,
+  decltype(std::declval<double>() + std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_double_int_minus(const double* __restrict a, const int* __restrict b,
+  decltype(std::declval<double>() - std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_double_int_mul(const double* __restrict a, const int* __restrict b,
+  decltype(std::declval<double>() * std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_double_int_div(const double* __restrict a, const int* __restrict b,
+  decltype(std::declval<double>() / std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_double_long_plus(const double* __restrict a, const long* __restrict b,
+  decltype(std::declval<double>() + std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_double_long_minus(const double* __restrict a, const long* __restrict b,
+  decltype(std::declval<double>() - std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_double_long_mul(const double* __restrict a, const long* __restrict b,
+  decltype(std::declval<double>() * std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_double_long_div(const double* __restrict a, const long* __restrict b,
+  decltype(std::declval<double>() / std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_double_unsigned_plus(const double* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<double>() + std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_double_unsigned_minus(const double* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<double>() - std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_double_unsigned_mul(const double* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<double>() * std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_double_unsigned_div(const double* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<double>() / std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_double_float_plus(const double* __restrict a, const float* __restrict b,
+  decltype(std::declval<double>() + std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_double_float_minus(const double* __restrict a, const float* __restrict b,
+  decltype(std::declval<double>() - std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_double_float_mul(const double* __restrict a, const float* __restrict b,
+  decltype(std::declval<double>() * std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_double_float_div(const double* __restrict a, const float* __restrict b,
+  decltype(std::declval<double>() / std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_double_double_plus(const double* __restrict a, const double* __restrict b,
+  decltype(std::declval<double>() + std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_double_double_minus(const double* __restrict a, const double* __restrict b,
+  decltype(std::declval<double>() - std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_double_double_mul(const double* __restrict a, const double* __restrict b,
+  decltype(std::declval<double>() * std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_double_double_div(const double* __restrict a, const double* __restrict b,
+  decltype(std::declval<double>() / std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_double_std__int64_t_plus(const double* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<double>() + std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_double_std__int64_t_minus(const double* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<double>() - std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_double_std__int64_t_mul(const double* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<double>() * std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_double_std__int64_t_div(const double* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<double>() / std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_double_std__uint8_t_plus(const double* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<double>() + std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_double_std__uint8_t_minus(const double* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<double>() - std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_double_std__uint8_t_mul(const double* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<double>() * std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_double_std__uint8_t_div(const double* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<double>() / std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_std__int64_t_char_plus(const std::int64_t* __restrict a, const char* __restrict b,
+  decltype(std::declval<std::int64_t>() + std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_std__int64_t_char_minus(const std::int64_t* __restrict a, const char* __restrict b,
+  decltype(std::declval<std::int64_t>() - std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_std__int64_t_char_mul(const std::int64_t* __restrict a, const char* __restrict b,
+  decltype(std::declval<std::int64_t>() * std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_std__int64_t_char_div(const std::int64_t* __restrict a, const char* __restrict b,
+  decltype(std::declval<std::int64_t>() / std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_std__int64_t_short_plus(const std::int64_t* __restrict a, const short* __restrict b,
+  decltype(std::declval<std::int64_t>() + std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_std__int64_t_short_minus(const std::int64_t* __restrict a, const short* __restrict b,
+  decltype(std::declval<std::int64_t>() - std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_std__int64_t_short_mul(const std::int64_t* __restrict a, const short* __restrict b,
+  decltype(std::declval<std::int64_t>() * std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_std__int64_t_short_div(const std::int64_t* __restrict a, const short* __restrict b,
+  decltype(std::declval<std::int64_t>() / std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_std__int64_t_int_plus(const std::int64_t* __restrict a, const int* __restrict b,
+  decltype(std::declval<std::int64_t>() + std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_std__int64_t_int_minus(const std::int64_t* __restrict a, const int* __restrict b,
+  decltype(std::declval<std::int64_t>() - std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_std__int64_t_int_mul(const std::int64_t* __restrict a, const int* __restrict b,
+  decltype(std::declval<std::int64_t>() * std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_std__int64_t_int_div(const std::int64_t* __restrict a, const int* __restrict b,
+  decltype(std::declval<std::int64_t>() / std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_std__int64_t_long_plus(const std::int64_t* __restrict a, const long* __restrict b,
+  decltype(std::declval<std::int64_t>() + std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_std__int64_t_long_minus(const std::int64_t* __restrict a, const long* __restrict b,
+  decltype(std::declval<std::int64_t>() - std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_std__int64_t_long_mul(const std::int64_t* __restrict a, const long* __restrict b,
+  decltype(std::declval<std::int64_t>() * std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_std__int64_t_long_div(const std::int64_t* __restrict a, const long* __restrict b,
+  decltype(std::declval<std::int64_t>() / std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_std__int64_t_unsigned_plus(const std::int64_t* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<std::int64_t>() + std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_std__int64_t_unsigned_minus(const std::int64_t* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<std::int64_t>() - std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_std__int64_t_unsigned_mul(const std::int64_t* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<std::int64_t>() * std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_std__int64_t_unsigned_div(const std::int64_t* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<std::int64_t>() / std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_std__int64_t_float_plus(const std::int64_t* __restrict a, const float* __restrict b,
+  decltype(std::declval<std::int64_t>() + std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_std__int64_t_float_minus(const std::int64_t* __restrict a, const float* __restrict b,
+  decltype(std::declval<std::int64_t>() - std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_std__int64_t_float_mul(const std::int64_t* __restrict a, const float* __restrict b,
+  decltype(std::declval<std::int64_t>() * std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_std__int64_t_float_div(const std::int64_t* __restrict a, const float* __restrict b,
+  decltype(std::declval<std::int64_t>() / std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_std__int64_t_double_plus(const std::int64_t* __restrict a, const double* __restrict b,
+  decltype(std::declval<std::int64_t>() + std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_std__int64_t_double_minus(const std::int64_t* __restrict a, const double* __restrict b,
+  decltype(std::declval<std::int64_t>() - std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_std__int64_t_double_mul(const std::int64_t* __restrict a, const double* __restrict b,
+  decltype(std::declval<std::int64_t>() * std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_std__int64_t_double_div(const std::int64_t* __restrict a, const double* __restrict b,
+  decltype(std::declval<std::int64_t>() / std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_std__int64_t_std__int64_t_plus(const std::int64_t* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<std::int64_t>() + std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_std__int64_t_std__int64_t_minus(const std::int64_t* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<std::int64_t>() - std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_std__int64_t_std__int64_t_mul(const std::int64_t* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<std::int64_t>() * std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_std__int64_t_std__int64_t_div(const std::int64_t* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<std::int64_t>() / std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_std__int64_t_std__uint8_t_plus(const std::int64_t* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<std::int64_t>() + std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_std__int64_t_std__uint8_t_minus(const std::int64_t* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<std::int64_t>() - std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_std__int64_t_std__uint8_t_mul(const std::int64_t* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<std::int64_t>() * std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_std__int64_t_std__uint8_t_div(const std::int64_t* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<std::int64_t>() / std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_std__uint8_t_char_plus(const std::uint8_t* __restrict a, const char* __restrict b,
+  decltype(std::declval<std::uint8_t>() + std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_std__uint8_t_char_minus(const std::uint8_t* __restrict a, const char* __restrict b,
+  decltype(std::declval<std::uint8_t>() - std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_std__uint8_t_char_mul(const std::uint8_t* __restrict a, const char* __restrict b,
+  decltype(std::declval<std::uint8_t>() * std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_std__uint8_t_char_div(const std::uint8_t* __restrict a, const char* __restrict b,
+  decltype(std::declval<std::uint8_t>() / std::declval<char>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_std__uint8_t_short_plus(const std::uint8_t* __restrict a, const short* __restrict b,
+  decltype(std::declval<std::uint8_t>() + std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_std__uint8_t_short_minus(const std::uint8_t* __restrict a, const short* __restrict b,
+  decltype(std::declval<std::uint8_t>() - std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_std__uint8_t_short_mul(const std::uint8_t* __restrict a, const short* __restrict b,
+  decltype(std::declval<std::uint8_t>() * std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_std__uint8_t_short_div(const std::uint8_t* __restrict a, const short* __restrict b,
+  decltype(std::declval<std::uint8_t>() / std::declval<short>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_std__uint8_t_int_plus(const std::uint8_t* __restrict a, const int* __restrict b,
+  decltype(std::declval<std::uint8_t>() + std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_std__uint8_t_int_minus(const std::uint8_t* __restrict a, const int* __restrict b,
+  decltype(std::declval<std::uint8_t>() - std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_std__uint8_t_int_mul(const std::uint8_t* __restrict a, const int* __restrict b,
+  decltype(std::declval<std::uint8_t>() * std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_std__uint8_t_int_div(const std::uint8_t* __restrict a, const int* __restrict b,
+  decltype(std::declval<std::uint8_t>() / std::declval<int>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_std__uint8_t_long_plus(const std::uint8_t* __restrict a, const long* __restrict b,
+  decltype(std::declval<std::uint8_t>() + std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_std__uint8_t_long_minus(const std::uint8_t* __restrict a, const long* __restrict b,
+  decltype(std::declval<std::uint8_t>() - std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_std__uint8_t_long_mul(const std::uint8_t* __restrict a, const long* __restrict b,
+  decltype(std::declval<std::uint8_t>() * std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_std__uint8_t_long_div(const std::uint8_t* __restrict a, const long* __restrict b,
+  decltype(std::declval<std::uint8_t>() / std::declval<long>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_std__uint8_t_unsigned_plus(const std::uint8_t* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<std::uint8_t>() + std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_std__uint8_t_unsigned_minus(const std::uint8_t* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<std::uint8_t>() - std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_std__uint8_t_unsigned_mul(const std::uint8_t* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<std::uint8_t>() * std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_std__uint8_t_unsigned_div(const std::uint8_t* __restrict a, const unsigned* __restrict b,
+  decltype(std::declval<std::uint8_t>() / std::declval<unsigned>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_std__uint8_t_float_plus(const std::uint8_t* __restrict a, const float* __restrict b,
+  decltype(std::declval<std::uint8_t>() + std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_std__uint8_t_float_minus(const std::uint8_t* __restrict a, const float* __restrict b,
+  decltype(std::declval<std::uint8_t>() - std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_std__uint8_t_float_mul(const std::uint8_t* __restrict a, const float* __restrict b,
+  decltype(std::declval<std::uint8_t>() * std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_std__uint8_t_float_div(const std::uint8_t* __restrict a, const float* __restrict b,
+  decltype(std::declval<std::uint8_t>() / std::declval<float>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_std__uint8_t_double_plus(const std::uint8_t* __restrict a, const double* __restrict b,
+  decltype(std::declval<std::uint8_t>() + std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_std__uint8_t_double_minus(const std::uint8_t* __restrict a, const double* __restrict b,
+  decltype(std::declval<std::uint8_t>() - std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_std__uint8_t_double_mul(const std::uint8_t* __restrict a, const double* __restrict b,
+  decltype(std::declval<std::uint8_t>() * std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_std__uint8_t_double_div(const std::uint8_t* __restrict a, const double* __restrict b,
+  decltype(std::declval<std::uint8_t>() / std::declval<double>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_std__uint8_t_std__int64_t_plus(const std::uint8_t* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<std::uint8_t>() + std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_std__uint8_t_std__int64_t_minus(const std::uint8_t* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<std::uint8_t>() - std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_std__uint8_t_std__int64_t_mul(const std::uint8_t* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<std::uint8_t>() * std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_std__uint8_t_std__int64_t_div(const std::uint8_t* __restrict a, const std::int64_t* __restrict b,
+  decltype(std::declval<std::uint8_t>() / std::declval<std::int64_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void kernel_std__uint8_t_std__uint8_t_plus(const std::uint8_t* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<std::uint8_t>() + std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] + b[i];
+}
+
+void kernel_std__uint8_t_std__uint8_t_minus(const std::uint8_t* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<std::uint8_t>() - std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] - b[i];
+}
+
+void kernel_std__uint8_t_std__uint8_t_mul(const std::uint8_t* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<std::uint8_t>() * std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] * b[i];
+}
+
+void kernel_std__uint8_t_std__uint8_t_div(const std::uint8_t* __restrict a, const std::uint8_t* __restrict b,
+  decltype(std::declval<std::uint8_t>() / std::declval<std::uint8_t>())* __restrict result, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+    result[i] = a[i] / b[i];
+}
+
+void RunKernels()
+{
+  RunKernel("char", "char", "+", kernel_char_char_plus);
+  RunKernel("char", "char", "-", kernel_char_char_minus);
+  RunKernel("char", "char", "*", kernel_char_char_mul);
+  RunKernel("char", "char", "/", kernel_char_char_div);
+  RunKernel("char", "short", "+", kernel_char_short_plus);
+  RunKernel("char", "short", "-", kernel_char_short_minus);
+  RunKernel("char", "short", "*", kernel_char_short_mul);
+  RunKernel("char", "short", "/", kernel_char_short_div);
+  RunKernel("char", "int", "+", kernel_char_int_plus);
+  RunKernel("char", "int", "-", kernel_char_int_minus);
+  RunKernel("char", "int", "*", kernel_char_int_mul);
+  RunKernel("char", "int", "/", kernel_char_int_div);
+  RunKernel("char", "long", "+", kernel_char_long_plus);
+  RunKernel("char", "long", "-", kernel_char_long_minus);
+  RunKernel("char", "long", "*", kernel_char_long_mul);
+  RunKernel("char", "long", "/", kernel_char_long_div);
+  RunKernel("char", "unsigned", "+", kernel_char_unsigned_plus);
+  RunKernel("char", "unsigned", "-", kernel_char_unsigned_minus);
+  RunKernel("char", "unsigned", "*", kernel_char_unsigned_mul);
+  RunKernel("char", "unsigned", "/", kernel_char_unsigned_div);
+  RunKernel("char", "float", "+", kernel_char_float_plus);
+  RunKernel("char", "float", "-", kernel_char_float_minus);
+  RunKernel("char", "float", "*", kernel_char_float_mul);
+  RunKernel("char", "float", "/", kernel_char_float_div);
+  RunKernel("char", "double", "+", kernel_char_double_plus);
+  RunKernel("char", "double", "-", kernel_char_double_minus);
+  RunKernel("char", "double", "*", kernel_char_double_mul);
+  RunKernel("char", "double", "/", kernel_char_double_div);
+  RunKernel("char", "std::int64_t", "+", kernel_char_std__int64_t_plus);
+  RunKernel("char", "std::int64_t", "-", kernel_char_std__int64_t_minus);
+  RunKernel("char", "std::int64_t", "*", kernel_char_std__int64_t_mul);
+  RunKernel("char", "std::int64_t", "/", kernel_char_std__int64_t_div);
+  RunKernel("char", "std::uint8_t", "+", kernel_char_std__uint8_t_plus);
+  RunKernel("char", "std::uint8_t", "-", kernel_char_std__uint8_t_minus);
+  RunKernel("char", "std::uint8_t", "*", kernel_char_std__uint8_t_mul);
+  RunKernel("char", "std::uint8_t", "/", kernel_char_std__uint8_t_div);
+  RunKernel("short", "char", "+", kernel_short_char_plus);
+  RunKernel("short", "char", "-", kernel_short_char_minus);
+  RunKernel("short", "char", "*", kernel_short_char_mul);
+  RunKernel("short", "char", "/", kernel_short_char_div);
+  RunKernel("short", "short", "+", kernel_short_short_plus);
+  RunKernel("short", "short", "-", kernel_short_short_minus);
+  RunKernel("short", "short", "*", kernel_short_short_mul);
+  RunKernel("short", "short", "/", kernel_short_short_div);
+  RunKernel("short", "int", "+", kernel_short_int_plus);
+  RunKernel("short", "int", "-", kernel_short_int_minus);
+  RunKernel("short", "int", "*", kernel_short_int_mul);
+  RunKernel("short", "int", "/", kernel_short_int_div);
+  RunKernel("short", "long", "+", kernel_short_long_plus);
+  RunKernel("short", "long", "-", kernel_short_long_minus);
+  RunKernel("short", "long", "*", kernel_short_long_mul);
+  RunKernel("short", "long", "/", kernel_short_long_div);
+  RunKernel("short", "unsigned", "+", kernel_short_unsigned_plus);
+  RunKernel("short", "unsigned", "-", kernel_short_unsigned_minus);
+  RunKernel("short", "unsigned", "*", kernel_short_unsigned_mul);
+  RunKernel("short", "unsigned", "/", kernel_short_unsigned_div);
+  RunKernel("short", "float", "+", kernel_short_float_plus);
+  RunKernel("short", "float", "-", kernel_short_float_minus);
+  RunKernel("short", "float", "*", kernel_short_float_mul);
+  RunKernel("short", "float", "/", kernel_short_float_div);
+  RunKernel("short", "double", "+", kernel_short_double_plus);
+  RunKernel("short", "double", "-", kernel_short_double_minus);
+  RunKernel("short", "double", "*", kernel_short_double_mul);
+  RunKernel("short", "double", "/", kernel_short_double_div);
+  RunKernel("short", "std::int64_t", "+", kernel_short_std__int64_t_plus);
+  RunKernel("short", "std::int64_t", "-", kernel_short_std__int64_t_minus);
+  RunKernel("short", "std::int64_t", "*", kernel_short_std__int64_t_mul);
+  RunKernel("short", "std::int64_t", "/", kernel_short_std__int64_t_div);
+  RunKernel("short", "std::uint8_t", "+", kernel_short_std__uint8_t_plus);
+  RunKernel("short", "std::uint8_t", "-", kernel_short_std__uint8_t_minus);
+  RunKernel("short", "std::uint8_t", "*", kernel_short_std__uint8_t_mul);
+  RunKernel("short", "std::uint8_t", "/", kernel_short_std__uint8_t_div);
+  RunKernel("int", "char", "+", kernel_int_char_plus);
+  RunKernel("int", "char", "-", kernel_int_char_minus);
+  RunKernel("int", "char", "*", kernel_int_char_mul);
+  RunKernel("int", "char", "/", kernel_int_char_div);
+  RunKernel("int", "short", "+", kernel_int_short_plus);
+  RunKernel("int", "short", "-", kernel_int_short_minus);
+  RunKernel("int", "short", "*", kernel_int_short_mul);
+  RunKernel("int", "short", "/", kernel_int_short_div);
+  RunKernel("int", "int", "+", kernel_int_int_plus);
+  RunKernel("int", "int", "-", kernel_int_int_minus);
+  RunKernel("int", "int", "*", kernel_int_int_mul);
+  RunKernel("int", "int", "/", kernel_int_int_div);
+  RunKernel("int", "long", "+", kernel_int_long_plus);
+  RunKernel("int", "long", "-", kernel_int_long_minus);
+  RunKernel("int", "long", "*", kernel_int_long_mul);
+  RunKernel("int", "long", "/", kernel_int_long_div);
+  RunKernel("int", "unsigned", "+", kernel_int_unsigned_plus);
+  RunKernel("int", "unsigned", "-", kernel_int_unsigned_minus);
+  RunKernel("int", "unsigned", "*", kernel_int_unsigned_mul);
+  RunKernel("int", "unsigned", "/", kernel_int_unsigned_div);
+  RunKernel("int", "float", "+", kernel_int_float_plus);
+  RunKernel("int", "float", "-", kernel_int_float_minus);
+  RunKernel("int", "float", "*", kernel_int_float_mul);
+  RunKernel("int", "float", "/", kernel_int_float_div);
+  RunKernel("int", "double", "+", kernel_int_double_plus);
+  RunKernel("int", "double", "-", kernel_int_double_minus);
+  RunKernel("int", "double", "*", kernel_int_double_mul);
+  RunKernel("int", "double", "/", kernel_int_double_div);
+  RunKernel("int", "std::int64_t", "+", kernel_int_std__int64_t_plus);
+  RunKernel("int", "std::int64_t", "-", kernel_int_std__int64_t_minus);
+  RunKernel("int", "std::int64_t", "*", kernel_int_std__int64_t_mul);
+  RunKernel("int", "std::int64_t", "/", kernel_int_std__int64_t_div);
+  RunKernel("int", "std::uint8_t", "+", kernel_int_std__uint8_t_plus);
+  RunKernel("int", "std::uint8_t", "-", kernel_int_std__uint8_t_minus);
+  RunKernel("int", "std::uint8_t", "*", kernel_int_std__uint8_t_mul);
+  RunKernel("int", "std::uint8_t", "/", kernel_int_std__uint8_t_div);
+  RunKernel("long", "char", "+", kernel_long_char_plus);
+  RunKernel("long", "char", "-", kernel_long_char_minus);
+  RunKernel("long", "char", "*", kernel_long_char_mul);
+  RunKernel("long", "char", "/", kernel_long_char_div);
+  RunKernel("long", "short", "+", kernel_long_short_plus);
+  RunKernel("long", "short", "-", kernel_long_short_minus);
+  RunKernel("long", "short", "*", kernel_long_short_mul);
+  RunKernel("long", "short", "/", kernel_long_short_div);
+  RunKernel("long", "int", "+", kernel_long_int_plus);
+  RunKernel("long", "int", "-", kernel_long_int_minus);
+  RunKernel("long", "int", "*", kernel_long_int_mul);
+  RunKernel("long", "int", "/", kernel_long_int_div);
+  RunKernel("long", "long", "+", kernel_long_long_plus);
+  RunKernel("long", "long", "-", kernel_long_long_minus);
+  RunKernel("long", "long", "*", kernel_long_long_mul);
+  RunKernel("long", "long", "/", kernel_long_long_div);
+  RunKernel("long", "unsigned", "+", kernel_long_unsigned_plus);
+  RunKernel("long", "unsigned", "-", kernel_long_unsigned_minus);
+  RunKernel("long", "unsigned", "*", kernel_long_unsigned_mul);
+  RunKernel("long", "unsigned", "/", kernel_long_unsigned_div);
+  RunKernel("long", "float", "+", kernel_long_float_plus);
+  RunKernel("long", "float", "-", kernel_long_float_minus);
+  RunKernel("long", "float", "*", kernel_long_float_mul);
+  RunKernel("long", "float", "/", kernel_long_float_div);
+  RunKernel("long", "double", "+", kernel_long_double_plus);
+  RunKernel("long", "double", "-", kernel_long_double_minus);
+  RunKernel("long", "double", "*", kernel_long_double_mul);
+  RunKernel("long", "double", "/", kernel_long_double_div);
+  RunKernel("long", "std::int64_t", "+", kernel_long_std__int64_t_plus);
+  RunKernel("long", "std::int64_t", "-", kernel_long_std__int64_t_minus);
+  RunKernel("long", "std::int64_t", "*", kernel_long_std__int64_t_mul);
+  RunKernel("long", "std::int64_t", "/", kernel_long_std__int64_t_div);
+  RunKernel("long", "std::uint8_t", "+", kernel_long_std__uint8_t_plus);
+  RunKernel("long", "std::uint8_t", "-", kernel_long_std__uint8_t_minus);
+  RunKernel("long", "std::uint8_t", "*", kernel_long_std__uint8_t_mul);
+  RunKernel("long", "std::uint8_t", "/", kernel_long_std__uint8_t_div);
+  RunKernel("unsigned", "char", "+", kernel_unsigned_char_plus);
+  RunKernel("unsigned", "char", "-", kernel_unsigned_char_minus);
+  RunKernel("unsigned", "char", "*", kernel_unsigned_char_mul);
+  RunKernel("unsigned", "char", "/", kernel_unsigned_char_div);
+  RunKernel("unsigned", "short", "+", kernel_unsigned_short_plus);
+  RunKernel("unsigned", "short", "-", kernel_unsigned_short_minus);
+  RunKernel("unsigned", "short", "*", kernel_unsigned_short_mul);
+  RunKernel("unsigned", "short", "/", kernel_unsigned_short_div);
+  RunKernel("unsigned", "int", "+", kernel_unsigned_int_plus);
+  RunKernel("unsigned", "int", "-", kernel_unsigned_int_minus);
+  RunKernel("unsigned", "int", "*", kernel_unsigned_int_mul);
+  RunKernel("unsigned", "int", "/", kernel_unsigned_int_div);
+  RunKernel("unsigned", "long", "+", kernel_unsigned_long_plus);
+  RunKernel("unsigned", "long", "-", kernel_unsigned_long_minus);
+  RunKernel("unsigned", "long", "*", kernel_unsigned_long_mul);
+  RunKernel("unsigned", "long", "/", kernel_unsigned_long_div);
+  RunKernel("unsigned", "unsigned", "+", kernel_unsigned_unsigned_plus);
+  RunKernel("unsigned", "unsigned", "-", kernel_unsigned_unsigned_minus);
+  RunKernel("unsigned", "unsigned", "*", kernel_unsigned_unsigned_mul);
+  RunKernel("unsigned", "unsigned", "/", kernel_unsigned_unsigned_div);
+  RunKernel("unsigned", "float", "+", kernel_unsigned_float_plus);
+  RunKernel("unsigned", "float", "-", kernel_unsigned_float_minus);
+  RunKernel("unsigned", "float", "*", kernel_unsigned_float_mul);
+  RunKernel("unsigned", "float", "/", kernel_unsigned_float_div);
+  RunKernel("unsigned", "double", "+", kernel_unsigned_double_plus);
+  RunKernel("unsigned", "double", "-", kernel_unsigned_double_minus);
+  RunKernel("unsigned", "double", "*", kernel_unsigned_double_mul);
+  RunKernel("unsigned", "double", "/", kernel_unsigned_double_div);
+  RunKernel("unsigned", "std::int64_t", "+", kernel_unsigned_std__int64_t_plus);
+  RunKernel("unsigned", "std::int64_t", "-", kernel_unsigned_std__int64_t_minus);
+  RunKernel("unsigned", "std::int64_t", "*", kernel_unsigned_std__int64_t_mul);
+  RunKernel("unsigned", "std::int64_t", "/", kernel_unsigned_std__int64_t_div);
+  RunKernel("unsigned", "std::uint8_t", "+", kernel_unsigned_std__uint8_t_plus);
+  RunKernel("unsigned", "std::uint8_t", "-", kernel_unsigned_std__uint8_t_minus);
+  RunKernel("unsigned", "std::uint8_t", "*", kernel_unsigned_std__uint8_t_mul);
+  RunKernel("unsigned", "std::uint8_t", "/", kernel_unsigned_std__uint8_t_div);
+  RunKernel("float", "char", "+", kernel_float_char_plus);
+  RunKernel("float", "char", "-", kernel_float_char_minus);
+  RunKernel("float", "char", "*", kernel_float_char_mul);
+  RunKernel("float", "char", "/", kernel_float_char_div);
+  RunKernel("float", "short", "+", kernel_float_short_plus);
+  RunKernel("float", "short", "-", kernel_float_short_minus);
+  RunKernel("float", "short", "*", kernel_float_short_mul);
+  RunKernel("float", "short", "/", kernel_float_short_div);
+  RunKernel("float", "int", "+", kernel_float_int_plus);
+  RunKernel("float", "int", "-", kernel_float_int_minus);
+  RunKernel("float", "int", "*", kernel_float_int_mul);
+  RunKernel("float", "int", "/", kernel_float_int_div);
+  RunKernel("float", "long", "+", kernel_float_long_plus);
+  RunKernel("float", "long", "-", kernel_float_long_minus);
+  RunKernel("float", "long", "*", kernel_float_long_mul);
+  RunKernel("float", "long", "/", kernel_float_long_div);
+  RunKernel("float", "unsigned", "+", kernel_float_unsigned_plus);
+  RunKernel("float", "unsigned", "-", kernel_float_unsigned_minus);
+  RunKernel("float", "unsigned", "*", kernel_float_unsigned_mul);
+  RunKernel("float", "unsigned", "/", kernel_float_unsigned_div);
+  RunKernel("float", "float", "+", kernel_float_float_plus);
+  RunKernel("float", "float", "-", kernel_float_float_minus);
+  RunKernel("float", "float", "*", kernel_float_float_mul);
+  RunKernel("float", "float", "/", kernel_float_float_div);
+  RunKernel("float", "double", "+", kernel_float_double_plus);
+  RunKernel("float", "double", "-", kernel_float_double_minus);
+  RunKernel("float", "double", "*", kernel_float_double_mul);
+  RunKernel("float", "double", "/", kernel_float_double_div);
+  RunKernel("float", "std::int64_t", "+", kernel_float_std__int64_t_plus);
+  RunKernel("float", "std::int64_t", "-", kernel_float_std__int64_t_minus);
+  RunKernel("float", "std::int64_t", "*", kernel_float_std__int64_t_mul);
+  RunKernel("float", "std::int64_t", "/", kernel_float_std__int64_t_div);
+  RunKernel("float", "std::uint8_t", "+", kernel_float_std__uint8_t_plus);
+  RunKernel("float", "std::uint8_t", "-", kernel_float_std__uint8_t_minus);
+  RunKernel("float", "std::uint8_t", "*", kernel_float_std__uint8_t_mul);
+  RunKernel("float", "std::uint8_t", "/", kernel_float_std__uint8_t_div);
+  RunKernel("double", "char", "+", kernel_double_char_plus);
+  RunKernel("double", "char", "-", kernel_double_char_minus);
+  RunKernel("double", "char", "*", kernel_double_char_mul);
+  RunKernel("double", "char", "/", kernel_double_char_div);
+  RunKernel("double", "short", "+", kernel_double_short_plus);
+  RunKernel("double", "short", "-", kernel_double_short_minus);
+  RunKernel("double", "short", "*", kernel_double_short_mul);
+  RunKernel("double", "short", "/", kernel_double_short_div);
+  RunKernel("double", "int", "+", kernel_double_int_plus);
+  RunKernel("double", "int", "-", kernel_double_int_minus);
+  RunKernel("double", "int", "*", kernel_double_int_mul);
+  RunKernel("double", "int", "/", kernel_double_int_div);
+  RunKernel("double", "long", "+", kernel_double_long_plus);
+  RunKernel("double", "long", "-", kernel_double_long_minus);
+  RunKernel("double", "long", "*", kernel_double_long_mul);
+  RunKernel("double", "long", "/", kernel_double_long_div);
+  RunKernel("double", "unsigned", "+", kernel_double_unsigned_plus);
+  RunKernel("double", "unsigned", "-", kernel_double_unsigned_minus);
+  RunKernel("double", "unsigned", "*", kernel_double_unsigned_mul);
+  RunKernel("double", "unsigned", "/", kernel_double_unsigned_div);
+  RunKernel("double", "float", "+", kernel_double_float_plus);
+  RunKernel("double", "float", "-", kernel_double_float_minus);
+  RunKernel("double", "float", "*", kernel_double_float_mul);
+  RunKernel("double", "float", "/", kernel_double_float_div);
+  RunKernel("double", "double", "+", kernel_double_double_plus);
+  RunKernel("double", "double", "-", kernel_double_double_minus);
+  RunKernel("double", "double", "*", kernel_double_double_mul);
+  RunKernel("double", "double", "/", kernel_double_double_div);
+  RunKernel("double", "std::int64_t", "+", kernel_double_std__int64_t_plus);
+  RunKernel("double", "std::int64_t", "-", kernel_double_std__int64_t_minus);
+  RunKernel("double", "std::int64_t", "*", kernel_double_std__int64_t_mul);
+  RunKernel("double", "std::int64_t", "/", kernel_double_std__int64_t_div);
+  RunKernel("double", "std::uint8_t", "+", kernel_double_std__uint8_t_plus);
+  RunKernel("double", "std::uint8_t", "-", kernel_double_std__uint8_t_minus);
+  RunKernel("double", "std::uint8_t", "*", kernel_double_std__uint8_t_mul);
+  RunKernel("double", "std::uint8_t", "/", kernel_double_std__uint8_t_div);
+  RunKernel("std::int64_t", "char", "+", kernel_std__int64_t_char_plus);
+  RunKernel("std::int64_t", "char", "-", kernel_std__int64_t_char_minus);
+  RunKernel("std::int64_t", "char", "*", kernel_std__int64_t_char_mul);
+  RunKernel("std::int64_t", "char", "/", kernel_std__int64_t_char_div);
+  RunKernel("std::int64_t", "short", "+", kernel_std__int64_t_short_plus);
+  RunKernel("std::int64_t", "short", "-", kernel_std__int64_t_short_minus);
+  RunKernel("std::int64_t", "short", "*", kernel_std__int64_t_short_mul);
+  RunKernel("std::int64_t", "short", "/", kernel_std__int64_t_short_div);
+  RunKernel("std::int64_t", "int", "+", kernel_std__int64_t_int_plus);
+  RunKernel("std::int64_t", "int", "-", kernel_std__int64_t_int_minus);
+  RunKernel("std::int64_t", "int", "*", kernel_std__int64_t_int_mul);
+  RunKernel("std::int64_t", "int", "/", kernel_std__int64_t_int_div);
+  RunKernel("std::int64_t", "long", "+", kernel_std__int64_t_long_plus);
+  RunKernel("std::int64_t", "long", "-", kernel_std__int64_t_long_minus);
+  RunKernel("std::int64_t", "long", "*", kernel_std__int64_t_long_mul);
+  RunKernel("std::int64_t", "long", "/", kernel_std__int64_t_long_div);
+  RunKernel("std::int64_t", "unsigned", "+", kernel_std__int64_t_unsigned_plus);
+  RunKernel("std::int64_t", "unsigned", "-", kernel_std__int64_t_unsigned_minus);
+  RunKernel("std::int64_t", "unsigned", "*", kernel_std__int64_t_unsigned_mul);
+  RunKernel("std::int64_t", "unsigned", "/", kernel_std__int64_t_unsigned_div);
+  RunKernel("std::int64_t", "float", "+", kernel_std__int64_t_float_plus);
+  RunKernel("std::int64_t", "float", "-", kernel_std__int64_t_float_minus);
+  RunKernel("std::int64_t", "float", "*", kernel_std__int64_t_float_mul);
+  RunKernel("std::int64_t", "float", "/", kernel_std__int64_t_float_div);
+  RunKernel("std::int64_t", "double", "+", kernel_std__int64_t_double_plus);
+  RunKernel("std::int64_t", "double", "-", kernel_std__int64_t_double_minus);
+  RunKernel("std::int64_t", "double", "*", kernel_std__int64_t_double_mul);
+  RunKernel("std::int64_t", "double", "/", kernel_std__int64_t_double_div);
+  RunKernel("std::int64_t", "std::int64_t", "+", kernel_std__int64_t_std__int64_t_plus);
+  RunKernel("std::int64_t", "std::int64_t", "-", kernel_std__int64_t_std__int64_t_minus);
+  RunKernel("std::int64_t", "std::int64_t", "*", kernel_std__int64_t_std__int64_t_mul);
+  RunKernel("std::int64_t", "std::int64_t", "/", kernel_std__int64_t_std__int64_t_div);
+  RunKernel("std::int64_t", "std::uint8_t", "+", kernel_std__int64_t_std__uint8_t_plus);
+  RunKernel("std::int64_t", "std::uint8_t", "-", kernel_std__int64_t_std__uint8_t_minus);
+  RunKernel("std::int64_t", "std::uint8_t", "*", kernel_std__int64_t_std__uint8_t_mul);
+  RunKernel("std::int64_t", "std::uint8_t", "/", kernel_std__int64_t_std__uint8_t_div);
+  RunKernel("std::uint8_t", "char", "+", kernel_std__uint8_t_char_plus);
+  RunKernel("std::uint8_t", "char", "-", kernel_std__uint8_t_char_minus);
+  RunKernel("std::uint8_t", "char", "*", kernel_std__uint8_t_char_mul);
+  RunKernel("std::uint8_t", "char", "/", kernel_std__uint8_t_char_div);
+  RunKernel("std::uint8_t", "short", "+", kernel_std__uint8_t_short_plus);
+  RunKernel("std::uint8_t", "short", "-", kernel_std__uint8_t_short_minus);
+  RunKernel("std::uint8_t", "short", "*", kernel_std__uint8_t_short_mul);
+  RunKernel("std::uint8_t", "short", "/", kernel_std__uint8_t_short_div);
+  RunKernel("std::uint8_t", "int", "+", kernel_std__uint8_t_int_plus);
+  RunKernel("std::uint8_t", "int", "-", kernel_std__uint8_t_int_minus);
+  RunKernel("std::uint8_t", "int", "*", kernel_std__uint8_t_int_mul);
+  RunKernel("std::uint8_t", "int", "/", kernel_std__uint8_t_int_div);
+  RunKernel("std::uint8_t", "long", "+", kernel_std__uint8_t_long_plus);
+  RunKernel("std::uint8_t", "long", "-", kernel_std__uint8_t_long_minus);
+  RunKernel("std::uint8_t", "long", "*", kernel_std__uint8_t_long_mul);
+  RunKernel("std::uint8_t", "long", "/", kernel_std__uint8_t_long_div);
+  RunKernel("std::uint8_t", "unsigned", "+", kernel_std__uint8_t_unsigned_plus);
+  RunKernel("std::uint8_t", "unsigned", "-", kernel_std__uint8_t_unsigned_minus);
+  RunKernel("std::uint8_t", "unsigned", "*", kernel_std__uint8_t_unsigned_mul);
+  RunKernel("std::uint8_t", "unsigned", "/", kernel_std__uint8_t_unsigned_div);
+  RunKernel("std::uint8_t", "float", "+", kernel_std__uint8_t_float_plus);
+  RunKernel("std::uint8_t", "float", "-", kernel_std__uint8_t_float_minus);
+  RunKernel("std::uint8_t", "float", "*", kernel_std__uint8_t_float_mul);
+  RunKernel("std::uint8_t", "float", "/", kernel_std__uint8_t_float_div);
+  RunKernel("std::uint8_t", "double", "+", kernel_std__uint8_t_double_plus);
+  RunKernel("std::uint8_t", "double", "-", kernel_std__uint8_t_double_minus);
+  RunKernel("std::uint8_t", "double", "*", kernel_std__uint8_t_double_mul);
+  RunKernel("std::uint8_t", "double", "/", kernel_std__uint8_t_double_div);
+  RunKernel("std::uint8_t", "std::int64_t", "+", kernel_std__uint8_t_std__int64_t_plus);
+  RunKernel("std::uint8_t", "std::int64_t", "-", kernel_std__uint8_t_std__int64_t_minus);
+  RunKernel("std::uint8_t", "std::int64_t", "*", kernel_std__uint8_t_std__int64_t_mul);
+  RunKernel("std::uint8_t", "std::int64_t", "/", kernel_std__uint8_t_std__int64_t_div);
+  RunKernel("std::uint8_t", "std::uint8_t", "+", kernel_std__uint8_t_std__uint8_t_plus);
+  RunKernel("std::uint8_t", "std::uint8_t", "-", kernel_std__uint8_t_std__uint8_t_minus);
+  RunKernel("std::uint8_t", "std::uint8_t", "*", kernel_std__uint8_t_std__uint8_t_mul);
+  RunKernel("std::uint8_t", "std::uint8_t", "/", kernel_std__uint8_t_std__uint8_t_div);
+}
+// Inputs hash: b58bf8e4297d826c
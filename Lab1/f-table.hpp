@@ -0,0 +1,18 @@
+// Generated by 'generator --batch type-pairs.txt', do not edit
+// Inputs hash: 457e0a3fa6850bfa
+#ifndef F_TABLE_HPP
+#define F_TABLE_HPP
+
+#include <cstddef>
+
+// The generated functions of f-batch.cpp by the types of their operands
+struct FEntry {
+  const char* typeA;
+  const char* typeB;
+  int (*function)();
+};
+
+extern const FEntry fTable[];
+extern const std::size_t fTableSize;
+
+#endif // F_TABLE_HPP
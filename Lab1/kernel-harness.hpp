@@ -0,0 +1,58 @@
+#ifndef KERNEL_HARNESS_HPP
+#define KERNEL_HARNESS_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+// Timing of the kernels generated by 'generator --kernels' (f-kernels.cpp)
+
+// Elements per array: the arrays don't fit the L2 cache, so the loads and the stores are counted too
+constexpr std::size_t kernelArraySize = 1 << 20;
+constexpr double kernelMinSeconds = 0.05;
+
+// Run 'kernel' over the arrays until kernelMinSeconds pass and print the elements per second
+template<typename A, typename B, typename R>
+void RunKernel(const char* typeA, const char* typeB, const char* oper, void (*kernel)(const A*, const B*, R*, std::size_t))
+{
+	// Small values, so no type overflows, and 'b' is never zero for the division
+	std::vector<A> a(kernelArraySize);
+	std::vector<B> b(kernelArraySize);
+	std::vector<R> result(kernelArraySize);
+	for (std::size_t i = 0; i < kernelArraySize; ++i)
+	{
+		a[i] = static_cast<A>(1 + i % 100);
+		b[i] = static_cast<B>(1 + i * 7 % 100);
+	}
+
+	kernel(a.data(), b.data(), result.data(), kernelArraySize);	// warm up
+
+	std::size_t repetitions = 0;
+	double seconds = 0.0;
+	auto start = std::chrono::steady_clock::now();
+	while (seconds < kernelMinSeconds)
+	{
+		kernel(a.data(), b.data(), result.data(), kernelArraySize);
+		++repetitions;
+		seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	// The results are read, so the kernel calls can't be dropped
+	double checksum = 0.0;
+	for (const R& value : result)
+	{
+		checksum += static_cast<double>(value);
+	}
+
+	double elementsPerSecond = repetitions * kernelArraySize / seconds;
+	std::cout << std::left << std::setw(14) << typeA << std::setw(14) << typeB << std::setw(4) << oper
+		<< std::right << std::fixed << std::setprecision(1) << std::setw(10) << elementsPerSecond / 1e6 << " M elements/s"
+		<< "  (checksum " << std::setprecision(0) << checksum << ")\n";
+}
+
+// Defined in the generated f-kernels.cpp: calls RunKernel for every kernel
+void RunKernels();
+
+#endif // KERNEL_HARNESS_HPP
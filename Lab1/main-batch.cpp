@@ -0,0 +1,16 @@
+#include <iostream>
+#include "f-table.hpp"
+
+// Runs every function generated by 'generator --batch' (see f-table.hpp)
+int main()
+{
+	for (std::size_t i = 0; i < fTableSize; ++i)
+	{
+		std::cout << fTable[i].typeA << " and " << fTable[i].typeB << ":\n";
+		if (fTable[i].function() != 0)
+		{
+			return 1;
+		}
+	}
+	return 0;
+}
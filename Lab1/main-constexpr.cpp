@@ -0,0 +1,18 @@
+#include <iostream>
+#include <type_traits>
+#include "operators.hpp"
+
+// The computations of f() checked at compile time
+using Arithmetic = OperatorSet<'+', '-', '*', '/'>;
+
+static_assert(ComputeAll<int, double>(Arithmetic{}) == std::tuple{ 5.0, -1.0, 6.0, 2.0 / 3.0 });
+static_assert(ComputeAll<int, int>(Arithmetic{}) == std::tuple{ 5, -1, 6, 0 });
+static_assert(std::is_same_v<decltype(Apply<'+'>(char{}, char{})), int>);
+static_assert(std::is_same_v<decltype(Apply<'-'>(unsigned{}, int{})), unsigned>);
+static_assert(std::get<1>(ComputeAll<unsigned, int>(Arithmetic{})) == 0xFFFFFFFFu);
+
+int main()
+{
+	PrintAll<int, double>(std::cout, Operators{});
+	return 0;
+}
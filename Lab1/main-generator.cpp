@@ -1,16 +1,83 @@
 #include <iostream>
 #include <string>
 #include <fstream>
+#include <sstream>
+#include <vector>
+#include <utility>
+#include <set>
+#include <cstdint>
+#include <cctype>
+#include <iomanip>
 
+// Usage:
+//	generator
+//		reads 'typeA typeB' from the console and writes f.cpp
+//	generator --batch <pairs file>
+//		reads 'typeA typeB' lines from the file and writes one f-batch.cpp with a function per pair
+//		and the f-table.hpp dispatcher table
+//	generator --kernels <pairs file>
+//		writes f-kernels.cpp with a loop kernel over arrays for every pair and operator,
+//		timed by kernel-harness.hpp
+//	generator --operators
+//		writes operators.inc, the operators of operators.txt for the OperatorSet of operators.hpp
 
-int main()
+using TypePair = std::pair<std::string, std::string>;
+
+bool ReadFile(const std::string& path, std::string& content)
+{
+	std::ifstream fin{ path, std::ios::binary };
+	if (!fin.is_open())
+	{
+		std::cerr << "Error! Failed to open the " << path << " file!\n";
+		return false;
+	}
+	std::ostringstream buffer;
+	buffer << fin.rdbuf();
+	content = buffer.str();
+	return true;
+}
+
+// The operators are the non-whitespace chars of operators.txt
+std::vector<char> ParseOperators(const std::string& content)
+{
+	std::vector<char> operators;
+	std::istringstream operators_stream{ content };
+	for (char oper; operators_stream >> oper; )
+	{
+		operators.push_back(oper);
+	}
+	return operators;
+}
+
+// Write the function code which applies all the operators to 'a' and 'b'
+void WriteFunction(std::ostream& fout, const std::string& name, const TypePair& types, const std::vector<char>& operators)
+{
+	fout << "int " << name << "() { \n";
+	fout << "  " << types.first << " a = 2;\n";
+	fout << "  " << types.second << " b{ 3 };\n";
+	for (char oper : operators)
+	{
+		fout << "  std::cout << a " << oper << " b << \"\\n\"; \n";
+	}
+	fout << "  return 0;\n";
+	fout << "}\n";
+}
+
+int GenerateSingle()
 {
 	// Read variables types from console
-	std::string typeA, typeB;
-	std::cin >> typeA >> typeB;
-	std::clog << "Types of variables are: " << typeA << " and " << typeB << "\n";
+	TypePair types;
+	std::cin >> types.first >> types.second;
+	std::clog << "Types of variables are: " << types.first << " and " << types.second << "\n";
 
-	// Init a file stream	
+	std::string operatorsContent;
+	if (!ReadFile("operators.txt", operatorsContent))
+	{
+		return 1;
+	}
+	std::vector<char> operators = ParseOperators(operatorsContent);
+
+	// Init a file stream
 	std::ofstream fout{ "f.cpp" };
 	if (!fout.is_open())
 	{
@@ -18,29 +85,322 @@ int main()
 		return 1;
 	}
 
-	// Add reading from file of operators for operands
-
 	// Write the 'f()' function code to the file
 	fout << "#include <iostream>\n\n";
-	fout << "int f() { \n";
-	fout << "  " << typeA << " a = 2;\n";
-	fout << "  " << typeB << " b{ 3 };\n";
+	WriteFunction(fout, "f", types, operators);
+
+	std::clog << "Generated an f.cpp file!\n";
+
+	return 0;
+}
+
+// FNV-1a, enough to notice that the inputs of the batch have changed
+std::uint64_t HashInputs(const std::vector<std::string>& inputs)
+{
+	std::uint64_t hash = 14695981039346656037ull;
+	for (const std::string& input : inputs)
+	{
+		for (unsigned char c : input + '\0')
+		{
+			hash = (hash ^ c) * 1099511628211ull;
+		}
+	}
+	return hash;
+}
+
+std::string FormatHashLine(std::uint64_t hash)
+{
+	std::ostringstream line;
+	line << "// Inputs hash: " << std::hex << std::setw(16) << std::setfill('0') << hash;
+	return line.str();
+}
+
+// Whether the generated file has the hash line, i.e. it was generated from the same inputs
+bool ContainsLine(const std::string& path, const std::string& hashLine)
+{
+	std::ifstream fin{ path };
+	for (std::string line; std::getline(fin, line); )
+	{
+		if (line == hashLine)
+		{
+			return true;
+		}
+	}
+	return false;
+}
 
-	std::ifstream operators_file{ "operators.txt" };
-	if (!operators_file.is_open()) 
+// 'std::int64_t' -> 'std__int64_t', so any type name can be a part of an identifier
+std::string SanitizeTypeName(const std::string& type)
+{
+	std::string name = type;
+	for (char& c : name)
+	{
+		if (!std::isalnum(static_cast<unsigned char>(c)))
+		{
+			c = '_';
+		}
+	}
+	return name;
+}
+
+// Read the type pairs, the repeated ones are skipped
+std::vector<TypePair> ParseTypePairs(const std::string& content)
+{
+	std::vector<TypePair> pairs;
+	std::set<TypePair> seenPairs;
+	std::istringstream pairsStream{ content };
+	for (TypePair types; pairsStream >> types.first >> types.second; )
+	{
+		if (seenPairs.insert(types).second)
+		{
+			pairs.push_back(types);
+		}
+	}
+	return pairs;
+}
+
+// Different types may give the same sanitized name ('a::b' and 'a__b'), such a name gets a suffix
+std::string MakeUniqueName(const std::string& base, std::set<std::string>& usedNames)
+{
+	std::string name = base;
+	for (int suffix = 2; !usedNames.insert(name).second; ++suffix)
+	{
+		name = base + "_" + std::to_string(suffix);
+	}
+	return name;
+}
+
+int GenerateBatch(const std::string& pairsPath)
+{
+	std::string pairsContent, operatorsContent;
+	if (!ReadFile(pairsPath, pairsContent) || !ReadFile("operators.txt", operatorsContent))
 	{
-		std::cerr << "Error! Failed to open the operators.cpp file!\n";
 		return 1;
 	}
-	for (char oper; operators_file >> oper; )
+
+	// The generator version takes part too, so a change of the generated code regenerates the files
+	constexpr const char* generatorVersion = "batch-1";
+	std::string hashLine = FormatHashLine(HashInputs({ generatorVersion, pairsContent, operatorsContent }));
+	// The table header is written after f-batch.cpp
+	if (ContainsLine("f-table.hpp", hashLine) && std::ifstream{ "f-batch.cpp" }.is_open())
 	{
-		fout << "  std::cout << a " << oper << " b << \"\\n\"; \n";
+		std::clog << "f-batch.cpp is up to date, nothing to generate\n";
+		return 0;
 	}
 
-	fout << "  return 0;\n";
+	std::vector<TypePair> pairs = ParseTypePairs(pairsContent);
+	std::vector<char> operators = ParseOperators(operatorsContent);
+	// The table can't be empty: 'fTable[] = {}' is ill-formed
+	if (pairs.empty())
+	{
+		std::cerr << "Error! There are no type pairs in the " << pairsPath << " file!\n";
+		return 1;
+	}
+
+	std::ofstream fout{ "f-batch.cpp" };
+	if (!fout.is_open())
+	{
+		std::cerr << "Error! Failed to open the f-batch.cpp file!\n";
+		return 1;
+	}
+
+	fout << "// Generated by 'generator --batch " << pairsPath << "', do not edit\n";
+	fout << "#include \"f-table.hpp\"\n";
+	fout << "#include <cstdint>\n";
+	fout << "#include <iostream>\n";
+
+	std::vector<std::string> names;
+	std::set<std::string> usedNames;
+	for (const TypePair& types : pairs)
+	{
+		std::string name = MakeUniqueName("f_" + SanitizeTypeName(types.first) + "_" + SanitizeTypeName(types.second), usedNames);
+		names.push_back(name);
+
+		fout << "\n";
+		WriteFunction(fout, name, types, operators);
+	}
+
+	fout << "\nconst FEntry fTable[] = {\n";
+	for (std::size_t i = 0; i < pairs.size(); ++i)
+	{
+		fout << "  { \"" << pairs[i].first << "\", \"" << pairs[i].second << "\", " << names[i] << " },\n";
+	}
+	fout << "};\n";
+	fout << "const std::size_t fTableSize = " << pairs.size() << ";\n";
+	fout.close();
+
+	std::ofstream table{ "f-table.hpp" };
+	if (!table.is_open())
+	{
+		std::cerr << "Error! Failed to open the f-table.hpp file!\n";
+		return 1;
+	}
+	table << "// Generated by 'generator --batch " << pairsPath << "', do not edit\n";
+	table << hashLine << "\n";
+	table << "#ifndef F_TABLE_HPP\n";
+	table << "#define F_TABLE_HPP\n\n";
+	table << "#include <cstddef>\n\n";
+	table << "// The generated functions of f-batch.cpp by the types of their operands\n";
+	table << "struct FEntry {\n";
+	table << "  const char* typeA;\n";
+	table << "  const char* typeB;\n";
+	table << "  int (*function)();\n";
+	table << "};\n\n";
+	table << "extern const FEntry fTable[];\n";
+	table << "extern const std::size_t fTableSize;\n\n";
+	table << "#endif // F_TABLE_HPP\n";
+
+	std::clog << "Generated an f-batch.cpp file with " << pairs.size() << " functions!\n";
+
+	return 0;
+}
+
+// A name of the operator which can be a part of an identifier
+std::string GetOperatorName(char oper)
+{
+	switch (oper)
+	{
+	case '+': return "plus";
+	case '-': return "minus";
+	case '*': return "mul";
+	case '/': return "div";
+	case '%': return "mod";
+	case '&': return "and";
+	case '|': return "or";
+	case '^': return "xor";
+	default: return "op" + std::to_string(static_cast<unsigned char>(oper));
+	}
+}
+
+int GenerateKernels(const std::string& pairsPath)
+{
+	std::string pairsContent, operatorsContent;
+	if (!ReadFile(pairsPath, pairsContent) || !ReadFile("operators.txt", operatorsContent))
+	{
+		return 1;
+	}
+
+	// The hash line is the last one, so a partly written file is never taken as up to date
+	constexpr const char* generatorVersion = "kernels-1";
+	std::string hashLine = FormatHashLine(HashInputs({ generatorVersion, pairsContent, operatorsContent }));
+	if (ContainsLine("f-kernels.cpp", hashLine))
+	{
+		std::clog << "f-kernels.cpp is up to date, nothing to generate\n";
+		return 0;
+	}
+
+	std::vector<TypePair> pairs = ParseTypePairs(pairsContent);
+	std::vector<char> operators = ParseOperators(operatorsContent);
+
+	std::ofstream fout{ "f-kernels.cpp" };
+	if (!fout.is_open())
+	{
+		std::cerr << "Error! Failed to open the f-kernels.cpp file!\n";
+		return 1;
+	}
+
+	fout << "// Generated by 'generator --kernels " << pairsPath << "', do not edit\n";
+	fout << "#include \"kernel-harness.hpp\"\n";
+	fout << "#include <cstdint>\n";
+	fout << "#include <utility>\n";
+
+	// A plain loop over non-aliasing arrays, which the compiler can vectorize.
+	// The result has the type of 'a op b' (after the usual arithmetic conversions).
+	// A repeated operator or a sanitized type name collision gives a name suffix, as in the batch mode
+	std::vector<std::string> names;
+	std::set<std::string> usedNames;
+	for (const TypePair& types : pairs)
+	{
+		for (char oper : operators)
+		{
+			std::string name = MakeUniqueName("kernel_" + SanitizeTypeName(types.first) + "_" + SanitizeTypeName(types.second) + "_" + GetOperatorName(oper), usedNames);
+			names.push_back(name);
+
+			fout << "\nvoid " << name << "(const " << types.first << "* __restrict a, const " << types.second << "* __restrict b,\n";
+			fout << "  decltype(std::declval<" << types.first << ">() " << oper << " std::declval<" << types.second << ">())* __restrict result, std::size_t size)\n";
+			fout << "{\n";
+			fout << "  for (std::size_t i = 0; i < size; ++i)\n";
+			fout << "    result[i] = a[i] " << oper << " b[i];\n";
+			fout << "}\n";
+		}
+	}
+
+	fout << "\nvoid RunKernels()\n";
+	fout << "{\n";
+	std::size_t kernel = 0;
+	for (const TypePair& types : pairs)
+	{
+		for (char oper : operators)
+		{
+			fout << "  RunKernel(\"" << types.first << "\", \"" << types.second << "\", \"" << oper << "\", " << names[kernel++] << ");\n";
+		}
+	}
 	fout << "}\n";
+	fout << hashLine << "\n";
 
-	std::clog << "Generated an f.cpp file!\n";
+	std::clog << "Generated an f-kernels.cpp file with " << names.size() << " kernels!\n";
+
+	return 0;
+}
+
+int GenerateOperatorList()
+{
+	std::string operatorsContent;
+	if (!ReadFile("operators.txt", operatorsContent))
+	{
+		return 1;
+	}
+
+	// The char literals separated by commas: operators.hpp includes the file into a template argument list
+	std::ostringstream list;
+	list << "// Generated by 'generator --operators' from operators.txt, do not edit\n";
+	const char* separator = "";
+	for (char oper : ParseOperators(operatorsContent))
+	{
+		list << separator << '\'' << ((oper == '\'' || oper == '\\') ? "\\" : "") << oper << '\'';
+		separator = ", ";
+	}
+	list << "\n";
+
+	// An unchanged file isn't rewritten, so what includes it isn't rebuilt
+	std::string oldList;
+	if (std::ifstream{ "operators.inc" }.is_open() && ReadFile("operators.inc", oldList) && oldList == list.str())
+	{
+		std::clog << "operators.inc is up to date, nothing to generate\n";
+		return 0;
+	}
+
+	std::ofstream fout{ "operators.inc", std::ios::binary };
+	if (!fout.is_open())
+	{
+		std::cerr << "Error! Failed to open the operators.inc file!\n";
+		return 1;
+	}
+	fout << list.str();
+
+	std::clog << "Generated an operators.inc file!\n";
 
 	return 0;
-}
\ No newline at end of file
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc == 3 && std::string(argv[1]) == "--batch")
+	{
+		return GenerateBatch(argv[2]);
+	}
+	if (argc == 3 && std::string(argv[1]) == "--kernels")
+	{
+		return GenerateKernels(argv[2]);
+	}
+	if (argc == 2 && std::string(argv[1]) == "--operators")
+	{
+		return GenerateOperatorList();
+	}
+	if (argc != 1)
+	{
+		std::cerr << "Usage: generator [--batch <pairs file> | --kernels <pairs file> | --operators]\n";
+		return 1;
+	}
+	return GenerateSingle();
+}
@@ -0,0 +1,10 @@
+#include <iostream>
+#include "kernel-harness.hpp"
+
+// Reports the throughput of every kernel generated by 'generator --kernels'
+int main()
+{
+	std::cout << "Arrays of " << kernelArraySize << " elements\n";
+	RunKernels();
+	return 0;
+}
@@ -0,0 +1,63 @@
+#ifndef OPERATORS_HPP
+#define OPERATORS_HPP
+
+#include <cstddef>
+#include <ostream>
+#include <tuple>
+#include <utility>
+
+// The compile-time counterpart of the generated f(): the operand types and the operators are
+// template parameters, so the results of 'a op b' are constants and no code has to be generated.
+// ComputeAll<int, double>(Operators{}) gives the same values f() prints for 'int double'
+
+template<char... Opers>
+struct OperatorSet {
+	static constexpr std::size_t size = sizeof...(Opers);
+};
+
+// The operators of operators.txt ('generator --operators' writes operators.inc),
+// the four arithmetic ones when the file hasn't been generated
+#if __has_include("operators.inc")
+using Operators = OperatorSet<
+#include "operators.inc"
+>;
+#else
+using Operators = OperatorSet<'+', '-', '*', '/'>;
+#endif
+
+template<char Oper>
+inline constexpr bool isSupportedOperator = Oper == '+' || Oper == '-' || Oper == '*' || Oper == '/' || Oper == '%'
+	|| Oper == '&' || Oper == '|' || Oper == '^';
+
+template<char Oper, typename A, typename B>
+constexpr auto Apply(A a, B b)
+{
+	static_assert(isSupportedOperator<Oper>, "the operator is not supported");
+	if constexpr (Oper == '+') return a + b;
+	else if constexpr (Oper == '-') return a - b;
+	else if constexpr (Oper == '*') return a * b;
+	else if constexpr (Oper == '/') return a / b;
+	else if constexpr (Oper == '%') return a % b;
+	else if constexpr (Oper == '&') return a & b;
+	else if constexpr (Oper == '|') return a | b;
+	else if constexpr (Oper == '^') return a ^ b;
+}
+
+// The operands of f(): 'A a = 2;' and 'B b{ 3 };'
+template<typename A, typename B, char... Opers>
+constexpr auto ComputeAll(OperatorSet<Opers...>)
+{
+	A a = 2;
+	B b{ 3 };
+	return std::tuple{ Apply<Opers>(a, b)... };
+}
+
+// Print the results line by line, the same output as f()
+template<typename A, typename B, char... Opers>
+void PrintAll(std::ostream& out, OperatorSet<Opers...> operators)
+{
+	constexpr auto results = ComputeAll<A, B>(operators);
+	std::apply([&](const auto&... result) { ((out << result << "\n"), ...); }, results);
+}
+
+#endif // OPERATORS_HPP
@@ -0,0 +1,84 @@
+#ifndef LIFECYCLE_COUNTERS_H
+#define LIFECYCLE_COUNTERS_H
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+
+// Per-type totals of special member calls and heap usage, so code can check
+// what a container operation really did (e.g. "no copies on this path").
+// Build with LIFECYCLE_COUNTERS_ENABLED=0 to turn the counting into no-ops
+#ifndef LIFECYCLE_COUNTERS_ENABLED
+#define LIFECYCLE_COUNTERS_ENABLED 1
+#endif
+
+namespace lifecycle {
+	struct Counts {
+		std::uint64_t constructions = 0;	// not counting copies and moves
+		std::uint64_t copies = 0;			// copy constructions and copy assignments
+		std::uint64_t moves = 0;			// move constructions and move assignments
+		std::uint64_t destructions = 0;
+		std::uint64_t heapAllocations = 0;	// objects of new/new[] and buffers owned by any object
+		std::uint64_t heapBytes = 0;
+
+		Counts operator-(const Counts& other) const {
+			return { constructions - other.constructions, copies - other.copies, moves - other.moves,
+				destructions - other.destructions, heapAllocations - other.heapAllocations, heapBytes - other.heapBytes };
+		}
+	};
+
+	inline std::ostream& operator<<(std::ostream& out, const Counts& counts) {
+		return out << "constructions " << counts.constructions << ", copies " << counts.copies
+			<< ", moves " << counts.moves << ", destructions " << counts.destructions
+			<< ", heap allocations " << counts.heapAllocations << " (" << counts.heapBytes << " bytes)";
+	}
+
+	template<typename T>
+	class Counters {
+	public:
+		static constexpr bool enabled = LIFECYCLE_COUNTERS_ENABLED;
+
+		static void OnConstruct() noexcept { Increment(constructions_); }
+		static void OnCopy() noexcept { Increment(copies_); }
+		static void OnMove() noexcept { Increment(moves_); }
+		static void OnDestroy() noexcept { Increment(destructions_); }
+		static void OnHeapAllocation(std::uint64_t bytes) noexcept {
+			Increment(heapAllocations_);
+			Increment(heapBytes_, bytes);
+		}
+
+		static Counts Get() noexcept {
+			return { constructions_.load(std::memory_order_relaxed), copies_.load(std::memory_order_relaxed),
+				moves_.load(std::memory_order_relaxed), destructions_.load(std::memory_order_relaxed),
+				heapAllocations_.load(std::memory_order_relaxed), heapBytes_.load(std::memory_order_relaxed) };
+		}
+
+	private:
+		static void Increment(std::atomic<std::uint64_t>& counter, std::uint64_t value = 1) noexcept {
+			if constexpr (enabled) {
+				counter.fetch_add(value, std::memory_order_relaxed);
+			}
+		}
+
+		static inline std::atomic<std::uint64_t> constructions_{ 0 };
+		static inline std::atomic<std::uint64_t> copies_{ 0 };
+		static inline std::atomic<std::uint64_t> moves_{ 0 };
+		static inline std::atomic<std::uint64_t> destructions_{ 0 };
+		static inline std::atomic<std::uint64_t> heapAllocations_{ 0 };
+		static inline std::atomic<std::uint64_t> heapBytes_{ 0 };
+	};
+
+	// Counts of 'T' since the snapshot was taken
+	template<typename T>
+	class ScopedSnapshot {
+	public:
+		ScopedSnapshot() : start_(Counters<T>::Get()) {}
+
+		Counts Delta() const { return Counters<T>::Get() - start_; }
+
+	private:
+		Counts start_;
+	};
+}
+
+#endif // LIFECYCLE_COUNTERS_H
@@ -0,0 +1,166 @@
+#include "LifecycleTrace.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace lifecycle {
+	namespace {
+		// Single producer (the owning thread), single consumer (Drain() under the registry mutex)
+		class RingBuffer {
+		public:
+			static constexpr std::size_t capacity = 1 << 14;	// a power of 2
+
+			bool Push(const Event& event) noexcept {
+				std::size_t head = head_.load(std::memory_order_relaxed);
+				if (head - tail_.load(std::memory_order_acquire) == capacity) {
+					return false;
+				}
+				events_[head & (capacity - 1)] = event;
+				head_.store(head + 1, std::memory_order_release);
+				return true;
+			}
+
+			template<typename Func>
+			void PopAll(Func func) {
+				std::size_t tail = tail_.load(std::memory_order_relaxed);
+				std::size_t head = head_.load(std::memory_order_acquire);
+				for (; tail != head; ++tail) {
+					func(events_[tail & (capacity - 1)]);
+				}
+				tail_.store(tail, std::memory_order_release);
+			}
+
+			bool IsEmpty() const noexcept {
+				return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+			}
+
+			bool owned = false;		// a thread writes to it, guarded by the registry mutex
+
+		private:
+			alignas(64) std::atomic<std::size_t> head_{ 0 };
+			alignas(64) std::atomic<std::size_t> tail_{ 0 };
+			std::array<Event, capacity> events_;
+		};
+
+		// Buffers are owned here, so the events of finished threads can still be drained
+		struct Registry {
+			std::mutex mutex;
+			std::vector<std::unique_ptr<RingBuffer>> buffers;
+		};
+
+		// Never destroyed: events may be recorded by static destructors of other translation units
+		Registry& GetRegistry() {
+			static Registry* registry = new Registry;
+			return *registry;
+		}
+
+		std::atomic<std::uint64_t> droppedCount{ 0 };
+		std::atomic<bool> exitDrained{ false };
+
+		// The buffer of a finished thread is reused by a new thread once it's drained,
+		// so there are about as many buffers as threads running at once
+		RingBuffer* AcquireBuffer() {
+			Registry& registry = GetRegistry();
+			std::lock_guard lock(registry.mutex);
+			for (auto& buffer : registry.buffers) {
+				if (!buffer->owned && buffer->IsEmpty()) {
+					buffer->owned = true;
+					return buffer.get();
+				}
+			}
+			registry.buffers.push_back(std::make_unique<RingBuffer>());
+			registry.buffers.back()->owned = true;
+			return registry.buffers.back().get();
+		}
+
+		void ReleaseBuffer(RingBuffer* buffer) {
+			Registry& registry = GetRegistry();
+			std::lock_guard lock(registry.mutex);
+			buffer->owned = false;
+		}
+
+		// Set when the buffer owner of this thread is gone (a plain bool has no destructor,
+		// so the destructors of other thread_local objects can still read it)
+		thread_local bool bufferReleased = false;
+
+		// Holds the buffer of a thread and gives it back when the thread ends
+		struct BufferOwner {
+			BufferOwner() : buffer(AcquireBuffer()) {}
+			~BufferOwner() {
+				ReleaseBuffer(buffer);
+				bufferReleased = true;
+			}
+
+			RingBuffer* buffer;
+		};
+
+		RingBuffer* GetThreadBuffer() {
+			if (bufferReleased) {
+				return nullptr;
+			}
+			thread_local BufferOwner owner;
+			return owner.buffer;
+		}
+
+		const char* GetKindName(EventKind kind) {
+			switch (kind) {
+			case EventKind::Construct: return "Constructor";
+			case EventKind::CopyConstruct: return "Copy constructor";
+			case EventKind::MoveConstruct: return "Move constructor";
+			case EventKind::CopyAssign: return "Copy assignment";
+			case EventKind::MoveAssign: return "Move assignment";
+			case EventKind::Destroy: return "Destructor";
+			}
+			return "Unknown";
+		}
+
+		// Print what's left when the program ends, later events are not printed anymore
+		struct ExitDrainer {
+			~ExitDrainer() {
+				Drain(std::cout);
+				exitDrained.store(true, std::memory_order_relaxed);
+			}
+		} exitDrainer;
+	}
+
+	void Record(EventKind kind, const void* object) noexcept {
+		RingBuffer* buffer = exitDrained.load(std::memory_order_relaxed) ? nullptr : GetThreadBuffer();
+		if (buffer == nullptr) {
+			droppedCount.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		Event event{ object, static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()), kind };
+		if (!buffer->Push(event)) {
+			droppedCount.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	std::size_t Drain(std::ostream& out) {
+		std::vector<Event> events;
+		{
+			Registry& registry = GetRegistry();
+			std::lock_guard lock(registry.mutex);
+			for (auto& buffer : registry.buffers) {
+				buffer->PopAll([&](const Event& event) { events.push_back(event); });
+			}
+		}
+
+		std::stable_sort(events.begin(), events.end(), [](const Event& lhs, const Event& rhs) {
+			return lhs.timestamp < rhs.timestamp;
+		});
+		for (const Event& event : events) {
+			out << event.timestamp << " " << GetKindName(event.kind) << " " << event.object << "\n";
+		}
+		return events.size();
+	}
+
+	std::uint64_t GetDroppedCount() noexcept {
+		return droppedCount.load(std::memory_order_relaxed);
+	}
+}
@@ -0,0 +1,49 @@
+#ifndef LIFECYCLE_TRACE_H
+#define LIFECYCLE_TRACE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+// Lifecycle tracing of objects (constructors, assignments, destructors).
+// Build with LIFECYCLE_TRACE_ENABLED=1 to record the events: each thread writes compact
+// binary events into its own lock-free ring buffer, formatting and printing happen only
+// in Drain() (and at program exit). With LIFECYCLE_TRACE_ENABLED=0 LIFECYCLE_TRACE compiles to nothing.
+#ifndef LIFECYCLE_TRACE_ENABLED
+#define LIFECYCLE_TRACE_ENABLED 0
+#endif
+
+namespace lifecycle {
+	enum class EventKind : std::uint8_t {
+		Construct,
+		CopyConstruct,
+		MoveConstruct,
+		CopyAssign,
+		MoveAssign,
+		Destroy
+	};
+
+	struct Event {
+		const void* object;
+		std::uint64_t timestamp;	// steady clock ticks
+		EventKind kind;
+	};
+
+	// Hot path: one store into the ring buffer of the calling thread, the event is dropped if it's full
+	void Record(EventKind kind, const void* object) noexcept;
+
+	// Format the pending events of all threads in timestamp order, returns their number
+	std::size_t Drain(std::ostream& out);
+
+	// Events lost because a ring buffer was full or they came after the end of the thread
+	// buffer (destructors of thread_local objects) or after the exit drain
+	std::uint64_t GetDroppedCount() noexcept;
+}
+
+#if LIFECYCLE_TRACE_ENABLED
+#define LIFECYCLE_TRACE(kind, object) ::lifecycle::Record(::lifecycle::EventKind::kind, (object))
+#else
+#define LIFECYCLE_TRACE(kind, object) ((void)0)
+#endif
+
+#endif // LIFECYCLE_TRACE_H
@@ -1,84 +1,128 @@
 #include "Person.hpp"
+#include "LifecycleTrace.hpp"
+#include "LifecycleCounters.hpp"
+#include "SlabAllocator.hpp"
 #include <cstring>
-#include <iostream>
+
+Person::Person() noexcept {
+	lifecycle::Counters<Person>::OnConstruct();
+	LIFECYCLE_TRACE(Construct, this);
+}
 
 Person::Person(int age, const char* name) {
-	age_ = new int(age);
-	name_ = new char[strlen(name) + 1];		// include null-terminator '\0' 
-	strcpy(name_, name);
+	age_ = age;
+	length_ = strlen(name);
+	char* buffer = IsInline() ? inline_ : (heap_ = static_cast<char*>(slab::Allocate(length_ + 1)));
+	memcpy(buffer, name, length_ + 1);		// include null-terminator '\0'
+	if (!IsInline()) {
+		lifecycle::Counters<Person>::OnHeapAllocation(length_ + 1);
+	}
 
-	std::cout << "Default constructor: " << name_ << "\n";
+	lifecycle::Counters<Person>::OnConstruct();
+	LIFECYCLE_TRACE(Construct, this);
 }
 
 Person::Person(const Person& person) {
-	age_ = new int(*person.age_);
-	name_ = new char[strlen(person.name_) + 1];
-	strcpy(name_, person.name_);
+	CopyFrom(person);
 
-	std::cout << "Copy constructor from " << name_ << "\n";
+	lifecycle::Counters<Person>::OnCopy();
+	LIFECYCLE_TRACE(CopyConstruct, this);
 }
 
 Person::Person(Person&& person) noexcept {
-	age_ = person.age_;
-	name_ = person.name_;
-	person.age_ = nullptr;
-	person.name_ = nullptr;
+	MoveFrom(person);
 
-	std::cout << "Move constructor from " << name_ << "\n";
+	lifecycle::Counters<Person>::OnMove();
+	LIFECYCLE_TRACE(MoveConstruct, this);
 }
 
 Person& Person::operator=(const Person& person) {
-	if (age_ != nullptr) {
-		delete age_;
+	if (this != &person) {
+		Release();
+		CopyFrom(person);
 	}
-	if (name_ != nullptr) {
-		delete[] name_;
-	}
-
-	age_ = new int(*person.age_);
-	name_ = new char[strlen(person.name_) + 1];
-	strcpy(name_, person.name_);
 
-	std::cout << "Copy assignment from " << name_ << "\n";
+	lifecycle::Counters<Person>::OnCopy();
+	LIFECYCLE_TRACE(CopyAssign, this);
 
 	return *this;
 }
 
 Person& Person::operator=(Person&& person) noexcept {
-	if (age_ != nullptr) {
-		delete age_;
+	if (this != &person) {
+		Release();
+		MoveFrom(person);
 	}
-	if (name_ != nullptr) {
-		delete[] name_;
-	}
-
-	age_ = person.age_;
-	name_ = person.name_;
-	person.age_ = nullptr;
-	person.name_ = nullptr;
 
-	std::cout << "Move assignment from " << name_ << "\n";
+	lifecycle::Counters<Person>::OnMove();
+	LIFECYCLE_TRACE(MoveAssign, this);
 
 	return *this;
 }
 
 Person::~Person() noexcept {
-	if (name_ != nullptr) {
-		std::cout << "Destructor of " << name_ << "\n\n";
+	lifecycle::Counters<Person>::OnDestroy();
+	LIFECYCLE_TRACE(Destroy, this);
+
+	Release();
+}
+
+// The Person objects themselves are counted as heap allocations too, not only the name buffers
+void* Person::operator new(std::size_t size) {
+	void* pointer = slab::Allocate(size);
+	lifecycle::Counters<Person>::OnHeapAllocation(size);
+	return pointer;
+}
+
+// 'size' includes the array cookie, the sized operator delete[] gets the same value back
+void* Person::operator new[](std::size_t size) {
+	void* pointer = slab::Allocate(size);
+	lifecycle::Counters<Person>::OnHeapAllocation(size);
+	return pointer;
+}
+
+void Person::operator delete(void* pointer, std::size_t size) noexcept {
+	slab::Deallocate(pointer, size);
+}
+
+void Person::operator delete[](void* pointer, std::size_t size) noexcept {
+	slab::Deallocate(pointer, size);
+}
+
+void Person::SetAge(int age) {
+	age_ = age;
+}
+
+void Person::CopyFrom(const Person& person) {
+	age_ = person.age_;
+	length_ = person.length_;
+	if (IsInline()) {		// the common case: a fixed-size copy, no allocation and no strlen
+		memcpy(inline_, person.inline_, sizeof(inline_));
 	} else {
-		std::cout << "Destructor\n\n";
+		heap_ = static_cast<char*>(slab::Allocate(length_ + 1));
+		memcpy(heap_, person.heap_, length_ + 1);
+		lifecycle::Counters<Person>::OnHeapAllocation(length_ + 1);
 	}
-	
-	if (age_ != nullptr) {
-		delete age_;
-	}
-	if (name_ != nullptr) {
-		delete[] name_;
+}
+
+void Person::MoveFrom(Person& person) noexcept {
+	age_ = person.age_;
+	length_ = person.length_;
+	if (IsInline()) {
+		memcpy(inline_, person.inline_, sizeof(inline_));
+	} else {
+		heap_ = person.heap_;
 	}
+
+	// Leave the moved-from object with an empty inline name
+	person.length_ = 0;
+	person.inline_[0] = '\0';
 }
 
-void Person::SetAge(int age) {
-	if (age_ != nullptr) {
-		*age_ = age;
+void Person::Release() noexcept {
+	if (!IsInline()) {
+		slab::Deallocate(heap_, length_ + 1);
 	}
-}
\ No newline at end of file
+	length_ = 0;
+	inline_[0] = '\0';
+}
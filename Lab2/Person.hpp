@@ -1,9 +1,18 @@
 #ifndef PERSON_H
 #define PERSON_H
 
+#include "Relocation.hpp"
+#include <cstddef>
+#include <cstdint>
+
+// The age and names up to 'inlineCapacity' chars are stored inside the object,
+// only a longer name takes one heap allocation. The name length is cached.
+// Person objects (also the arrays) and long names are allocated from the slab allocator
 class Person {
 public:
-	Person() = default;
+	static constexpr std::size_t inlineCapacity = 22;
+
+	Person() noexcept;
 	Person(int age, const char* name);
 	Person(const Person& person);
 	Person(Person&& person) noexcept;
@@ -11,11 +20,33 @@ public:
 	Person& operator=(Person&& person) noexcept;
 	~Person() noexcept;
 
+	static void* operator new(std::size_t size);
+	static void* operator new[](std::size_t size);
+	static void operator delete(void* pointer, std::size_t size) noexcept;
+	static void operator delete[](void* pointer, std::size_t size) noexcept;
+
 	void SetAge(int age);
+	int GetAge() const { return age_; }
+	const char* GetName() const { return IsInline() ? inline_ : heap_; }
+	std::size_t GetNameLength() const { return length_; }
 
 private:
-	int* age_ = nullptr;
-	char* name_ = nullptr;
+	bool IsInline() const { return length_ <= inlineCapacity; }
+	void CopyFrom(const Person& person);
+	void MoveFrom(Person& person) noexcept;
+	void Release() noexcept;
+
+	int age_ = 0;
+	std::uint32_t length_ = 0;
+	union {
+		char inline_[inlineCapacity + 1] = {};	// include null-terminator '\0'
+		char* heap_;
+	};
 };
 
-#endif // PERSON_H
\ No newline at end of file
+// The name is found through 'length_', never through a pointer into the object itself,
+// so a Person can be moved to another address by copying its bytes
+template<>
+struct relocation::IsTriviallyRelocatable<Person> : std::true_type {};
+
+#endif // PERSON_H
@@ -0,0 +1,99 @@
+#ifndef RELOCATING_VECTOR_H
+#define RELOCATING_VECTOR_H
+
+#include "Relocation.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <utility>
+
+// A minimal vector which moves its elements to the new storage with relocation::Relocate,
+// so for a trivially relocatable T the growth is one memcpy: no move constructors and
+// destructors are called for the old elements (unlike std::vector)
+template<typename T>
+class RelocatingVector {
+public:
+	RelocatingVector() = default;
+	RelocatingVector(std::initializer_list<T> values) {
+		reserve(values.size());
+		for (const T& value : values) {
+			::new (static_cast<void*>(data_ + size_)) T(value);
+			++size_;
+		}
+	}
+	RelocatingVector(const RelocatingVector&) = delete;
+	RelocatingVector& operator=(const RelocatingVector&) = delete;
+	~RelocatingVector() {
+		std::destroy_n(data_, size_);
+		std::allocator<T>().deallocate(data_, capacity_);
+	}
+
+	void push_back(const T& value) { emplace_back(value); }
+	void push_back(T&& value) { emplace_back(std::move(value)); }
+
+	template<typename... Args>
+	T& emplace_back(Args&&... args) {
+		if (size_ == capacity_) {
+			return GrowAndEmplace(std::forward<Args>(args)...);
+		}
+		T* element = ::new (static_cast<void*>(data_ + size_)) T(std::forward<Args>(args)...);
+		++size_;
+		return *element;
+	}
+
+	void reserve(std::size_t capacity) {
+		if (capacity > capacity_) {
+			Reallocate(capacity);
+		}
+	}
+
+	std::size_t size() const { return size_; }
+	std::size_t capacity() const { return capacity_; }
+	bool empty() const { return size_ == 0; }
+
+	T& operator[](std::size_t index) { return data_[index]; }
+	const T& operator[](std::size_t index) const { return data_[index]; }
+
+	T* begin() { return data_; }
+	T* end() { return data_ + size_; }
+	const T* begin() const { return data_; }
+	const T* end() const { return data_ + size_; }
+
+private:
+	void Reallocate(std::size_t capacity) {
+		T* data = std::allocator<T>().allocate(capacity);
+		relocation::Relocate(data_, size_, data);
+		std::allocator<T>().deallocate(data_, capacity_);
+		data_ = data;
+		capacity_ = capacity;
+	}
+
+	// The new element is constructed first: 'args' may refer to an element of this vector
+	template<typename... Args>
+	T& GrowAndEmplace(Args&&... args) {
+		std::size_t capacity = std::max<std::size_t>(2 * capacity_, 1);
+		T* data = std::allocator<T>().allocate(capacity);
+		T* element = nullptr;
+		try {
+			element = ::new (static_cast<void*>(data + size_)) T(std::forward<Args>(args)...);
+		} catch (...) {
+			std::allocator<T>().deallocate(data, capacity);
+			throw;
+		}
+
+		relocation::Relocate(data_, size_, data);
+		std::allocator<T>().deallocate(data_, capacity_);
+		data_ = data;
+		capacity_ = capacity;
+		++size_;
+		return *element;
+	}
+
+	T* data_ = nullptr;
+	std::size_t size_ = 0;
+	std::size_t capacity_ = 0;
+};
+
+#endif // RELOCATING_VECTOR_H
@@ -0,0 +1,36 @@
+#ifndef RELOCATION_H
+#define RELOCATION_H
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+// "Relocation" is a move construction into new storage followed by the destruction of the source.
+// A trivially relocatable type can do both at once by copying its bytes: it keeps no pointers into
+// itself and nothing refers to the object's address. Specialize the trait to opt a type in
+namespace relocation {
+	template<typename T>
+	struct IsTriviallyRelocatable : std::is_trivially_copyable<T> {};
+
+	template<typename T>
+	inline constexpr bool isTriviallyRelocatable = IsTriviallyRelocatable<T>::value;
+
+	// Relocate 'count' objects from 'source' to the uninitialized 'destination', the source storage
+	// is left without objects (its memory can be freed without calling the destructors)
+	template<typename T>
+	void Relocate(T* source, std::size_t count, T* destination) noexcept {
+		static_assert(isTriviallyRelocatable<T> || std::is_nothrow_move_constructible_v<T>);
+		if constexpr (isTriviallyRelocatable<T>) {
+			if (count != 0) {
+				std::memcpy(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(T));
+			}
+		} else {
+			std::uninitialized_move_n(source, count, destination);
+			std::destroy_n(source, count);
+		}
+	}
+}
+
+#endif // RELOCATION_H
@@ -0,0 +1,172 @@
+#include "SlabAllocator.hpp"
+#include <array>
+#include <mutex>
+#include <new>
+
+namespace slab {
+#if SLAB_ALLOCATOR_ENABLED
+	namespace {
+		constexpr std::array<std::size_t, 5> classSizes{ 16, 32, 64, 128, 256 };
+		constexpr std::size_t slabBytes = 64 * 1024;
+		constexpr std::size_t batchSize = 32;		// blocks moved between a thread cache and a shared pool at once
+
+		struct FreeBlock {
+			FreeBlock* next;
+		};
+
+		int GetSizeClass(std::size_t size) {
+			for (std::size_t i = 0; i < classSizes.size(); ++i) {
+				if (size <= classSizes[i]) {
+					return static_cast<int>(i);
+				}
+			}
+			return -1;
+		}
+
+		// Free blocks of one size class shared by all threads
+		class SharedPool {
+		public:
+			// Take up to 'count' blocks as a list, a new slab is carved when there are none
+			FreeBlock* TakeBatch(std::size_t blockSize, std::size_t count, std::size_t& taken) {
+				std::lock_guard lock(mutex_);
+				if (freeList_ == nullptr) {
+					CarveSlab(blockSize);
+				}
+
+				FreeBlock* first = freeList_;
+				FreeBlock* last = first;
+				for (taken = 1; taken < count && last->next != nullptr; ++taken) {
+					last = last->next;
+				}
+				freeList_ = last->next;
+				last->next = nullptr;
+				return first;
+			}
+
+			void PutBatch(FreeBlock* first, FreeBlock* last) {
+				std::lock_guard lock(mutex_);
+				last->next = freeList_;
+				freeList_ = first;
+			}
+
+		private:
+			// Slabs are never returned to the global heap, the blocks are reused instead
+			void CarveSlab(std::size_t blockSize) {
+				char* slab = static_cast<char*>(::operator new(slabBytes));
+				for (std::size_t offset = 0; offset + blockSize <= slabBytes; offset += blockSize) {
+					FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + offset);
+					block->next = freeList_;
+					freeList_ = block;
+				}
+			}
+
+			std::mutex mutex_;
+			FreeBlock* freeList_ = nullptr;
+		};
+
+		// Never destroyed: blocks may be freed by static destructors of other translation units
+		SharedPool& GetSharedPool(int sizeClass) {
+			static SharedPool* pools = new SharedPool[classSizes.size()];
+			return pools[sizeClass];
+		}
+
+		// Set when the thread cache of this thread is gone: the destructors of other thread_local
+		// objects may still allocate and free blocks, they go to the shared pools one by one then.
+		// A plain bool has no destructor, so it can still be read after the cache is destroyed
+		thread_local bool threadCacheDestroyed = false;
+
+		// Per-thread free lists, no locking on the allocation path
+		class ThreadCache {
+		public:
+			~ThreadCache() {
+				for (std::size_t i = 0; i < classSizes.size(); ++i) {
+					if (freeLists_[i] != nullptr) {
+						FreeBlock* last = freeLists_[i];
+						while (last->next != nullptr) {
+							last = last->next;
+						}
+						GetSharedPool(i).PutBatch(freeLists_[i], last);
+					}
+				}
+				freeLists_.fill(nullptr);
+				counts_.fill(0);
+				threadCacheDestroyed = true;
+			}
+
+			void* Allocate(int sizeClass) {
+				if (freeLists_[sizeClass] == nullptr) {
+					freeLists_[sizeClass] = GetSharedPool(sizeClass).TakeBatch(classSizes[sizeClass], batchSize, counts_[sizeClass]);
+				}
+				FreeBlock* block = freeLists_[sizeClass];
+				freeLists_[sizeClass] = block->next;
+				--counts_[sizeClass];
+				return block;
+			}
+
+			void Deallocate(void* pointer, int sizeClass) noexcept {
+				FreeBlock* block = static_cast<FreeBlock*>(pointer);
+				block->next = freeLists_[sizeClass];
+				freeLists_[sizeClass] = block;
+
+				// Give a batch back when the thread frees much more than it allocates
+				if (++counts_[sizeClass] == 2 * batchSize) {
+					FreeBlock* last = block;
+					for (std::size_t i = 1; i < batchSize; ++i) {
+						last = last->next;
+					}
+					freeLists_[sizeClass] = last->next;
+					counts_[sizeClass] -= batchSize;
+					GetSharedPool(sizeClass).PutBatch(block, last);
+				}
+			}
+
+		private:
+			std::array<FreeBlock*, classSizes.size()> freeLists_{};
+			std::array<std::size_t, classSizes.size()> counts_{};
+		};
+
+		thread_local ThreadCache threadCache;
+
+		void* AllocateBlock(int sizeClass) {
+			if (threadCacheDestroyed) {
+				std::size_t taken;
+				return GetSharedPool(sizeClass).TakeBatch(classSizes[sizeClass], 1, taken);
+			}
+			return threadCache.Allocate(sizeClass);
+		}
+
+		void DeallocateBlock(void* pointer, int sizeClass) noexcept {
+			if (threadCacheDestroyed) {
+				FreeBlock* block = static_cast<FreeBlock*>(pointer);
+				GetSharedPool(sizeClass).PutBatch(block, block);
+				return;
+			}
+			threadCache.Deallocate(pointer, sizeClass);
+		}
+	}
+#endif
+
+	void* Allocate(std::size_t size) {
+#if SLAB_ALLOCATOR_ENABLED
+		int sizeClass = GetSizeClass(size);
+		if (sizeClass >= 0) {
+			return AllocateBlock(sizeClass);
+		}
+#endif
+		return ::operator new(size);
+	}
+
+	void Deallocate(void* pointer, std::size_t size) noexcept {
+		if (pointer == nullptr) {
+			return;
+		}
+#if SLAB_ALLOCATOR_ENABLED
+		int sizeClass = GetSizeClass(size);
+		if (sizeClass >= 0) {
+			DeallocateBlock(pointer, sizeClass);
+			return;
+		}
+#endif
+		::operator delete(pointer, size);
+	}
+}
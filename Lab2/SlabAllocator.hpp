@@ -0,0 +1,22 @@
+#ifndef SLAB_ALLOCATOR_H
+#define SLAB_ALLOCATOR_H
+
+#include <cstddef>
+
+// Size-class slab allocator for small objects (Person instances and their name buffers).
+// Blocks of 16..256 bytes are carved from 64 KiB slabs; every thread keeps a cache of free
+// blocks per size class and goes to the shared (locked) pools only to move whole batches.
+// Larger requests go to the global heap. Build with SLAB_ALLOCATOR_ENABLED=0 to forward
+// everything to the global heap (e.g. to compare the two in main-bench.cpp)
+#ifndef SLAB_ALLOCATOR_ENABLED
+#define SLAB_ALLOCATOR_ENABLED 1
+#endif
+
+namespace slab {
+	void* Allocate(std::size_t size);
+
+	// 'size' must be the same as the one given to Allocate
+	void Deallocate(void* pointer, std::size_t size) noexcept;
+}
+
+#endif // SLAB_ALLOCATOR_H
@@ -0,0 +1,130 @@
+#include "Person.hpp"
+#include "SlabAllocator.hpp"
+#include "RelocatingVector.hpp"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <thread>
+#include <vector>
+
+// The allocation-heavy scenarios of main-test.cpp repeated many times.
+// 'make bench' builds this with and without the slab allocator (SLAB_ALLOCATOR_ENABLED)
+namespace {
+	constexpr int iterations = 1'000'000;
+	constexpr int threadCount = 4;
+	const char* longName = "Maximilian Alexander Fitzgerald";	// longer than Person::inlineCapacity
+
+	template<typename Func>
+	void Measure(const char* scenario, Func func) {
+		auto start = std::chrono::steady_clock::now();
+		long long checksum = func();
+		auto end = std::chrono::steady_clock::now();
+		std::cout << "  " << std::left << std::setw(24) << scenario << std::right << std::fixed << std::setprecision(2)
+			<< std::setw(10) << std::chrono::duration<double, std::milli>(end - start).count() << " ms"
+			<< "  (checksum " << checksum << ")\n";
+	}
+
+	long long NewDelete() {
+		long long checksum = 0;
+		for (int i = 0; i < iterations; ++i) {
+			Person* b = new Person(i, "John");
+			checksum += b->GetAge();
+			delete b;
+		}
+		return checksum;
+	}
+
+	long long NewDeleteArray() {
+		long long checksum = 0;
+		for (int i = 0; i < iterations; ++i) {
+			Person* p_array = new Person[2]{ Person(i, "Martin"), Person(i, longName) };
+			checksum += p_array[1].GetNameLength();
+			delete[] p_array;
+		}
+		return checksum;
+	}
+
+	long long CopyLongNames() {
+		long long checksum = 0;
+		Person original{ 21, longName };
+		for (int i = 0; i < iterations; ++i) {
+			Person person1{ original };
+			Person person2;
+			person2 = person1;
+			checksum += person2.GetNameLength();
+		}
+		return checksum;
+	}
+
+	long long Containers() {
+		long long checksum = 0;
+		for (int i = 0; i < iterations / 100; ++i) {
+			std::vector<Person> p_vect;
+			std::list<Person> p_list;
+			for (int j = 0; j < 50; ++j) {
+				p_vect.emplace_back(j, longName);
+				p_list.emplace_back(j, "Brian");
+			}
+			checksum += p_vect.size() + p_list.size();
+		}
+		return checksum;
+	}
+
+	// Growth from an empty vector, the elements are moved (std::vector) or relocated (RelocatingVector)
+	template<typename Vector>
+	long long VectorGrowth() {
+		long long checksum = 0;
+		for (int i = 0; i < iterations / 1000; ++i) {
+			Vector p_vect;
+			for (int j = 0; j < 1000; ++j) {
+				p_vect.emplace_back(j, (j % 2 == 0) ? "Robert" : longName);
+			}
+			checksum += p_vect[999].GetAge();
+		}
+		return checksum;
+	}
+
+	// Objects are mostly freed by the thread which allocated them, the thread caches serve them
+	long long ThreadChurn() {
+		std::vector<long long> checksums(threadCount);
+		{
+			std::vector<std::jthread> threads;
+			for (int t = 0; t < threadCount; ++t) {
+				threads.emplace_back([&checksums, t]() {
+					// Summed locally: the neighbouring checksums share a cache line
+					long long checksum = 0;
+					std::vector<Person*> batch(64);
+					for (int i = 0; i < iterations / threadCount / 64; ++i) {
+						for (Person*& person : batch) {
+							person = new Person(i, longName);
+						}
+						for (Person* person : batch) {
+							checksum += person->GetAge();
+							delete person;
+						}
+					}
+					checksums[t] = checksum;
+				});
+			}
+		}
+
+		long long checksum = 0;
+		for (long long value : checksums) {
+			checksum += value;
+		}
+		return checksum;
+	}
+}
+
+int main() {
+	std::cout << (SLAB_ALLOCATOR_ENABLED ? "slab allocator" : "global heap") << ":\n";
+	Measure("new/delete", NewDelete);
+	Measure("new[]/delete[]", NewDeleteArray);
+	Measure("copy long names", CopyLongNames);
+	Measure("vector/list", Containers);
+	Measure("threads new/delete", ThreadChurn);
+	Measure("std::vector growth", VectorGrowth<std::vector<Person>>);
+	Measure("RelocatingVector growth", VectorGrowth<RelocatingVector<Person>>);
+	return 0;
+}
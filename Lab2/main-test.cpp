@@ -1,4 +1,6 @@
 #include "Person.hpp"
+#include "LifecycleTrace.hpp"
+#include "LifecycleCounters.hpp"
 #include <utility>
 #include <iostream>
 #include <vector>
@@ -57,12 +59,21 @@ int main() {
 	std::vector<Person> p_vect{ Person(30, "Jack"), Person(31, "Tony") };
 	std::list<Person> p_list{ Person(32, "Brian"), Person(33, "Rocky") };
 
+	lifecycle::ScopedSnapshot<Person> pushBackSnapshot;
 	p_vect.push_back({ 34, "Robert" });
+	lifecycle::Counts pushBackCounts = pushBackSnapshot.Delta();
+
+	lifecycle::ScopedSnapshot<Person> emplaceBackSnapshot;
 	p_vect.emplace_back(35, "Brad");
+	lifecycle::Counts emplaceBackCounts = emplaceBackSnapshot.Delta();
 
 	p_list.push_back({ 36, "Billy" });
 	p_list.emplace_back(37, "Michael");
 
+	lifecycle::Drain(std::cout);	// the rest is printed at exit
+	std::cout << "\nvector push_back: " << pushBackCounts << "\n";
+	std::cout << "vector emplace_back: " << emplaceBackCounts << "\n";
+	std::cout << "Total: " << lifecycle::Counters<Person>::Get() << "\n\n";
 	std::cout << "Final\n\n";
 
 	return 0;
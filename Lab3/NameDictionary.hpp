@@ -0,0 +1,152 @@
+#ifndef NAME_DICTIONARY_HPP
+#define	NAME_DICTIONARY_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Shared thread-safe dictionary of names: every distinct name is stored once and is
+// referred to by a dense integer id. While names are added in the lexicographic order
+// (see internAll) the id order is the name order, so names are compared as integers.
+class NameDictionary {
+public:
+	using NameId = std::uint32_t;
+	using Ranks = std::shared_ptr<const std::vector<std::uint32_t>>;
+
+	// Name order of ids for one sort: the ids themselves while they are ordered, otherwise the ranks
+	// of a snapshot, so no comparison locks the dictionary. Ids added after getOrder() aren't covered
+	class Order {
+	public:
+		explicit Order(Ranks ranks) : ranks_(std::move(ranks)) {}
+
+		bool operator()(NameId lhs, NameId rhs) const
+		{
+			if (!ranks_)
+				return lhs < rhs;
+			return (*ranks_)[lhs] < (*ranks_)[rhs];
+		}
+
+	private:
+		Ranks ranks_;
+	};
+
+	static NameDictionary& instance()
+	{
+		static NameDictionary dictionary;
+		return dictionary;
+	}
+
+	NameDictionary(const NameDictionary&) = delete;
+	NameDictionary& operator=(const NameDictionary&) = delete;
+
+	NameId intern(std::string_view name)
+	{
+		{
+			std::shared_lock lock(mutex_);
+			if (auto it = ids_.find(name); it != ids_.end())
+				return it->second;
+		}
+		std::unique_lock lock(mutex_);
+		return insert(name);
+	}
+
+	// Add the names sorted, so a vocabulary known in advance gets ordered ids
+	void internAll(std::span<const std::string> names)
+	{
+		std::vector<std::string_view> sorted(names.begin(), names.end());
+		std::sort(sorted.begin(), sorted.end());
+
+		std::unique_lock lock(mutex_);
+		for (std::string_view name : sorted)
+			insert(name);
+	}
+
+	const std::string& getName(NameId id) const
+	{	// the deque keeps the references valid while it grows
+		std::shared_lock lock(mutex_);
+		return names_[id];
+	}
+
+	std::size_t size() const
+	{
+		std::shared_lock lock(mutex_);
+		return names_.size();
+	}
+
+	// Whether the id order is still the lexicographic order of the names
+	bool isOrdered() const { return ordered_.load(std::memory_order_acquire); }
+
+	Order getOrder() const
+	{
+		return Order(isOrdered() ? nullptr : getRanks());
+	}
+
+	// (*ranks)[id] is the position of the name in the lexicographic order (equal to 'id' while ordered).
+	// The snapshot is computed once and shared until a name is added
+	Ranks getRanks() const
+	{
+		{
+			std::shared_lock lock(mutex_);
+			if (ranks_)
+				return ranks_;
+		}
+		std::unique_lock lock(mutex_);
+		if (!ranks_)
+			ranks_ = std::make_shared<const std::vector<std::uint32_t>>(computeRanks());
+		return ranks_;
+	}
+
+private:
+	// The empty name has id 0, it's what a default constructed Person refers to
+	NameDictionary() { insert(""); }
+
+	// Must be called with the exclusive lock held
+	NameId insert(std::string_view name)
+	{
+		if (auto it = ids_.find(name); it != ids_.end())
+			return it->second;
+
+		if (!names_.empty() && name < names_.back())
+			ordered_.store(false, std::memory_order_release);
+
+		NameId id = names_.size();
+		names_.emplace_back(name);
+		ranks_.reset();
+		ids_.emplace(names_.back(), id);
+		return id;
+	}
+
+	// Must be called with the lock held
+	std::vector<std::uint32_t> computeRanks() const
+	{
+		std::vector<NameId> ids(names_.size());
+		for (NameId id = 0; id < ids.size(); ++id)
+			ids[id] = id;
+		if (!isOrdered())
+		{
+			std::sort(ids.begin(), ids.end(), [&](NameId lhs, NameId rhs) { return names_[lhs] < names_[rhs]; });
+		}
+
+		std::vector<std::uint32_t> ranks(ids.size());
+		for (std::uint32_t rank = 0; rank < ids.size(); ++rank)
+			ranks[ids[rank]] = rank;
+		return ranks;
+	}
+
+	mutable std::shared_mutex mutex_;
+	std::deque<std::string> names_;
+	std::unordered_map<std::string_view, NameId> ids_;
+	std::atomic<bool> ordered_{ true };
+	mutable Ranks ranks_;		// the cached getRanks() snapshot, reset by insert
+};
+
+#endif	// NAME_DICTIONARY_HPP
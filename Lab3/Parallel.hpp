@@ -0,0 +1,135 @@
+#ifndef PARALLEL_HPP
+#define	PARALLEL_HPP
+
+#include "TopK.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Parallel versions of the pipeline algorithms. Work is split into chunks that
+// the threads take one by one, so a slow thread does not hold the others back.
+// The chunks have fixed sizes, so the results don't depend on the number of threads.
+
+inline unsigned GetThreadCount()
+{
+	return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Call 'func(chunkIndex)' for every chunk in [0, chunkCount), the calling thread takes part too
+template<typename Func>
+void ParallelFor(std::size_t chunkCount, Func func)
+{
+	std::atomic<std::size_t> nextChunk{ 0 };
+	auto worker = [&]() {
+		for (std::size_t chunk = nextChunk++; chunk < chunkCount; chunk = nextChunk++)
+			func(chunk);
+	};
+
+	std::size_t threadCount = std::min<std::size_t>(GetThreadCount(), chunkCount);
+	std::vector<std::jthread> threads;
+	threads.reserve(threadCount);
+	for (std::size_t i = 1; i < threadCount; ++i)
+		threads.emplace_back(worker);
+	worker();
+}
+
+// Fill [first, last) with 'filler(gen)'. Each chunk of a fixed size has its own RNG stream
+// seeded from (seed, chunk index), so the result depends only on the seed and not on the
+// number of threads or on the order in which the chunks are processed
+template<typename RandomIt, typename Filler>
+void ParallelGenerate(RandomIt first, RandomIt last, std::mt19937::result_type seed, Filler filler)
+{
+	constexpr std::size_t chunkSize = 1 << 14;
+	std::size_t size = std::distance(first, last);
+	ParallelFor((size + chunkSize - 1) / chunkSize, [&](std::size_t chunk) {
+		std::seed_seq seedSequence{ seed, static_cast<std::mt19937::result_type>(chunk) };
+		std::mt19937 gen(seedSequence);
+
+		RandomIt chunkFirst = first + chunk * chunkSize;
+		RandomIt chunkLast = first + std::min(size, (chunk + 1) * chunkSize);
+		std::generate(chunkFirst, chunkLast, [&]() { return filler(gen); });
+	});
+}
+
+template<typename RandomIt, typename OutputIt>
+OutputIt ParallelCopy(RandomIt first, RandomIt last, OutputIt out)
+{
+	constexpr std::size_t chunkSize = 1 << 16;
+	std::size_t size = std::distance(first, last);
+	ParallelFor((size + chunkSize - 1) / chunkSize, [&](std::size_t chunk) {
+		std::size_t chunkFirst = chunk * chunkSize, chunkLast = std::min(size, chunkFirst + chunkSize);
+		std::copy(first + chunkFirst, first + chunkLast, out + chunkFirst);
+	});
+	return out + size;
+}
+
+// Merge sort: the chunks are sorted in parallel, then neighbouring runs are merged
+// pairwise (also in parallel) until one run is left. Elements that are equivalent
+// for 'comp' may end up in another order than after std::sort
+template<typename RandomIt, typename Compare>
+void ParallelSort(RandomIt first, RandomIt last, Compare comp)
+{
+	constexpr std::size_t chunkSize = 1 << 16;
+	std::size_t size = std::distance(first, last);
+	std::size_t chunkCount = std::max<std::size_t>(1, (size + chunkSize - 1) / chunkSize);
+	auto chunkBegin = [&](std::size_t chunk) { return first + std::min(size, chunk * chunkSize); };
+
+	ParallelFor(chunkCount, [&](std::size_t chunk) {
+		std::sort(chunkBegin(chunk), chunkBegin(chunk + 1), comp);
+	});
+
+	for (std::size_t width = 1; width < chunkCount; width *= 2)
+	{
+		ParallelFor((chunkCount + 2 * width - 1) / (2 * width), [&](std::size_t pair) {
+			std::size_t left = 2 * width * pair;
+			std::size_t middle = std::min(chunkCount, left + width), right = std::min(chunkCount, left + 2 * width);
+			std::inplace_merge(chunkBegin(left), chunkBegin(middle), chunkBegin(right), comp);
+		});
+	}
+}
+
+// Parallel SelectFront: every chunk selects its own 'k' first elements, these candidates are
+// gathered at the front of the range and the final 'k' are selected among them only
+template<typename RandomIt, typename Compare>
+RandomIt ParallelSelectFront(RandomIt first, RandomIt last, std::size_t k, Compare comp)
+{
+	constexpr std::size_t chunkSize = 1 << 16;
+	std::size_t size = std::distance(first, last);
+	k = std::min(k, size);
+	std::size_t chunkCount = (size + chunkSize - 1) / chunkSize;
+	if (chunkCount <= 1 || chunkSize < 2 * k)
+	{	// a single chunk, or the candidates would make up most of the range
+		return SelectFront(first, last, k, comp);
+	}
+
+	ParallelFor(chunkCount, [&](std::size_t chunk) {
+		RandomIt chunkFirst = first + std::min(size, chunk * chunkSize);
+		RandomIt chunkLast = first + std::min(size, (chunk + 1) * chunkSize);
+		SelectFront(chunkFirst, chunkLast, k, comp);
+	});
+
+	// The chunks are at least 2k apart, so a block never overlaps the place it's swapped to
+	RandomIt candidatesEnd = first + std::min(size, k);
+	for (std::size_t chunk = 1; chunk < chunkCount; ++chunk)
+	{
+		RandomIt chunkFirst = first + std::min(size, chunk * chunkSize);
+		RandomIt blockLast = first + std::min(size, chunk * chunkSize + k);
+		candidatesEnd = std::swap_ranges(chunkFirst, blockLast, candidatesEnd);
+	}
+	return SelectFront(first, candidatesEnd, k, comp);
+}
+
+// Parallel SelectBack: SelectFront on the reversed range with the reversed order
+template<typename RandomIt, typename Compare>
+RandomIt ParallelSelectBack(RandomIt first, RandomIt last, std::size_t k, Compare comp)
+{
+	auto reversedEnd = ParallelSelectFront(std::make_reverse_iterator(last), std::make_reverse_iterator(first), k,
+		[&](const auto& lhs, const auto& rhs) { return comp(rhs, lhs); });
+	return reversedEnd.base();
+}
+
+#endif	// PARALLEL_HPP
@@ -1,23 +1,33 @@
 #ifndef PERSON_HPP
 #define	PERSON_HPP
 
+#include "NameDictionary.hpp"
 #include <string>
 
+// The name is kept as an id in the shared NameDictionary, so a Person is 8 bytes
 class Person {
 public:
+	using NameId = NameDictionary::NameId;
+
 	Person() = default;
 	Person(int age, const std::string& name)
 	{
 		age_ = age;
-		name_ = name;
+		nameId_ = NameDictionary::instance().intern(name);
+	}
+	Person(int age, NameId nameId)
+	{
+		age_ = age;
+		nameId_ = nameId;
 	}
 
 	int getAge() const { return age_; }
-	const std::string& getName() const { return name_; }
+	NameId getNameId() const { return nameId_; }
+	const std::string& getName() const { return NameDictionary::instance().getName(nameId_); }
 
 private:
 	int age_ = 0;
-	std::string name_;
+	NameId nameId_ = 0;
 };
 
-#endif	// PERSON_HPP
\ No newline at end of file
+#endif	// PERSON_HPP
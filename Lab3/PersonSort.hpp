@@ -0,0 +1,74 @@
+#ifndef PERSON_SORT_HPP
+#define	PERSON_SORT_HPP
+
+#include "Person.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+// Stable counting sort of [first, last): the element at 'first + i' goes to the bucket 'keys[i]'
+// (from [0, bucketCount)), 'keys' has a key for every element of the range.
+// One pass to count the buckets and one pass to move the elements
+template<typename RandomIt>
+void CountingSort(RandomIt first, RandomIt last, const std::vector<std::uint32_t>& keys, std::size_t bucketCount)
+{
+	using T = typename std::iterator_traits<RandomIt>::value_type;
+	std::size_t size = std::distance(first, last);
+
+	std::vector<std::size_t> bucketStarts(bucketCount + 1);
+	for (std::size_t i = 0; i < size; ++i)
+		++bucketStarts[keys[i] + 1];
+	for (std::size_t bucket = 1; bucket <= bucketCount; ++bucket)
+		bucketStarts[bucket] += bucketStarts[bucket - 1];
+
+	std::vector<T> buffer(size);
+	for (std::size_t i = 0; i < size; ++i)
+		buffer[bucketStarts[keys[i]]++] = std::move(first[i]);
+	std::move(buffer.begin(), buffer.end(), first);
+}
+
+// The largest number of buckets worth counting for 'size' elements, wider keys are compared instead
+inline std::size_t GetMaxBucketCount(std::size_t size)
+{
+	return std::max<std::size_t>(size, 1 << 16);
+}
+
+// Sort Persons by age in descending order and by name in ascending order (the pipeline comparator)
+// without comparing them: ages are a small bounded range and names are ranked dictionary ids,
+// so (age, name rank) is a bucket number. Falls back to std::sort for too wide key ranges
+template<typename RandomIt>
+void SortByAgeAndName(RandomIt first, RandomIt last)
+{
+	std::size_t size = std::distance(first, last);
+	if (size < 2)
+		return;
+
+	auto [minAge, maxAge] = std::minmax_element(first, last, [](const Person& lhs, const Person& rhs) {
+		return lhs.getAge() < rhs.getAge();
+	});
+	std::size_t ageCount = static_cast<std::size_t>(maxAge->getAge()) - minAge->getAge() + 1;
+	int oldestAge = maxAge->getAge();
+
+	NameDictionary::Ranks ranks = NameDictionary::instance().getRanks();
+	const std::vector<std::uint32_t>& nameRanks = *ranks;
+	std::size_t bucketCount = ageCount * nameRanks.size();
+	if (bucketCount > GetMaxBucketCount(size))
+	{
+		std::sort(first, last, [&](const Person& lhs, const Person& rhs) {
+			if (lhs.getAge() == rhs.getAge())
+				return nameRanks[lhs.getNameId()] < nameRanks[rhs.getNameId()];
+			return lhs.getAge() > rhs.getAge();
+		});
+		return;
+	}
+
+	std::vector<std::uint32_t> keys(size);
+	for (std::size_t i = 0; i < size; ++i)
+		keys[i] = static_cast<std::uint32_t>(oldestAge - first[i].getAge()) * nameRanks.size() + nameRanks[first[i].getNameId()];
+	CountingSort(first, last, keys, bucketCount);
+}
+
+#endif	// PERSON_SORT_HPP
@@ -0,0 +1,277 @@
+#ifndef PERSON_TABLE_HPP
+#define	PERSON_TABLE_HPP
+
+#include "Person.hpp"
+#include "TopK.hpp"
+#include "PersonSort.hpp"
+#include <string>
+#include <vector>
+#include <span>
+#include <random>
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <cstdint>
+
+// Columnar storage of Person records: ages and name ids are kept in separate
+// contiguous arrays, names themselves are stored once in the shared NameDictionary
+class PersonTable {
+public:
+	using NameId = NameDictionary::NameId;
+
+	// Fill in 'count' records with random ages and names, drawn in the same way as
+	// the Person-based pipeline does it (an age index first, then a name index)
+	template<typename Generator>
+	static PersonTable generate(std::size_t count, std::span<const int> ages, std::span<const std::string> names, Generator& gen)
+	{
+		NameDictionary& dictionary = NameDictionary::instance();
+		dictionary.internAll(names);
+		std::vector<NameId> nameIds(names.size());
+		for (std::size_t i = 0; i < names.size(); ++i)
+		{
+			nameIds[i] = dictionary.intern(names[i]);
+		}
+
+		PersonTable table;
+		std::uniform_int_distribution<std::size_t> ageGenerator(0, ages.size() - 1);
+		std::uniform_int_distribution<std::size_t> nameGenerator(0, names.size() - 1);
+		table.reserve(count);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			int age = ages[ageGenerator(gen)];
+			table.push_back(age, nameIds[nameGenerator(gen)]);
+		}
+		return table;
+	}
+
+	std::size_t size() const { return ages_.size(); }
+	bool empty() const { return ages_.empty(); }
+
+	void reserve(std::size_t count)
+	{
+		ages_.reserve(count);
+		nameIds_.reserve(count);
+	}
+
+	void push_back(int age, NameId nameId)
+	{
+		ages_.push_back(age);
+		nameIds_.push_back(nameId);
+	}
+
+	int getAge(std::size_t row) const { return ages_[row]; }
+	NameId getNameId(std::size_t row) const { return nameIds_[row]; }
+	const std::string& getName(std::size_t row) const { return NameDictionary::instance().getName(nameIds_[row]); }
+	Person getPerson(std::size_t row) const { return { getAge(row), getNameId(row) }; }
+
+	std::span<const int> ages() const { return ages_; }
+	std::span<const NameId> nameIds() const { return nameIds_; }
+
+	// Copy of rows [first, last)
+	PersonTable slice(std::size_t first, std::size_t last) const
+	{
+		PersonTable result;
+		result.ages_.assign(ages_.begin() + first, ages_.begin() + last);
+		result.nameIds_.assign(nameIds_.begin() + first, nameIds_.begin() + last);
+		return result;
+	}
+
+	void eraseRange(std::size_t first, std::size_t last)
+	{
+		ages_.erase(ages_.begin() + first, ages_.begin() + last);
+		nameIds_.erase(nameIds_.begin() + first, nameIds_.begin() + last);
+	}
+
+	void append(const PersonTable& other)
+	{
+		ages_.insert(ages_.end(), other.ages_.begin(), other.ages_.end());
+		nameIds_.insert(nameIds_.end(), other.nameIds_.begin(), other.nameIds_.end());
+	}
+
+	// By age in descending order and by name in ascending order (same as the Person comparator)
+	// Ages are a small range and names are dictionary ids, so this is a counting sort
+	// by (age, name rank) unless the age range is too wide
+	void sort()
+	{
+		if (empty())
+			return;
+
+		auto [minAge, maxAge] = std::minmax_element(ages_.begin(), ages_.end());
+		NameDictionary::Ranks ranks = NameDictionary::instance().getRanks();
+		const std::vector<std::uint32_t>& nameRanks = *ranks;
+		std::size_t bucketCount = (static_cast<std::size_t>(*maxAge) - *minAge + 1) * nameRanks.size();
+		if (bucketCount > GetMaxBucketCount(size()))
+		{
+			*this = gather(frontSortedRows(size()));
+			return;
+		}
+
+		std::vector<std::uint32_t> keys(size());
+		for (std::size_t row = 0; row < keys.size(); ++row)
+			keys[row] = static_cast<std::uint32_t>(*maxAge - ages_[row]) * nameRanks.size() + nameRanks[nameIds_[row]];
+
+		std::vector<std::size_t> rows = orderedRows();
+		CountingSort(rows.begin(), rows.end(), keys, bucketCount);
+		*this = gather(rows);
+	}
+
+	// Move the 'k' largest records to the front in the sorted order, the rest is left unordered
+	void partialSort(std::size_t k)
+	{
+		moveRowsTo(0, selectRows(std::min(k, size()), true));
+	}
+
+	// Move the 'k' smallest records to the back in the sorted order, the rest is left unordered
+	void partialSortBack(std::size_t k)
+	{
+		k = std::min(k, size());
+		moveRowsTo(size() - k, selectRows(k, false));
+	}
+
+	// The 'k' largest records in the sorted order
+	PersonTable topK(std::size_t k) const
+	{
+		return gather(selectRows(std::min(k, size()), true));
+	}
+
+	// The 'k' smallest records in the sorted order (the tail of the sorted table)
+	PersonTable bottomK(std::size_t k) const
+	{
+		return gather(selectRows(std::min(k, size()), false));
+	}
+
+	// Pairs of records with equal row numbers, up to the size of the smaller table
+	std::vector<std::pair<Person, Person>> zip(const PersonTable& other) const
+	{
+		std::size_t count = std::min(size(), other.size());
+		std::vector<std::pair<Person, Person>> result;
+		result.reserve(count);
+		for (std::size_t row = 0; row < count; ++row)
+		{
+			result.emplace_back(getPerson(row), other.getPerson(row));
+		}
+		return result;
+	}
+
+private:
+	// Age descending and name ascending packed into one integer per row: a smaller key goes first,
+	// so the sorting compares plain integers from one contiguous array
+	std::uint64_t sortKey(std::size_t row, const std::vector<std::uint32_t>& nameRanks) const
+	{
+		std::uint32_t age = static_cast<std::uint32_t>(ages_[row]) ^ 0x80000000u;	// keeps the signed order
+		return (static_cast<std::uint64_t>(~age) << 32) | nameRanks[nameIds_[row]];
+	}
+
+	std::vector<std::uint64_t> sortKeys() const
+	{
+		NameDictionary::Ranks ranks = NameDictionary::instance().getRanks();
+		std::vector<std::uint64_t> keys(size());
+		for (std::size_t row = 0; row < keys.size(); ++row)
+		{
+			keys[row] = sortKey(row, *ranks);
+		}
+		return keys;
+	}
+
+	// The rows of the 'count' largest (or smallest) records in the sorted order. One pass over the
+	// table with a heap of 'count' rows, so nothing of the size of the table is allocated
+	std::vector<std::size_t> selectRows(std::size_t count, bool largest) const
+	{
+		if (count == 0)
+			return {};
+
+		NameDictionary::Ranks ranks = NameDictionary::instance().getRanks();
+		// The top of the heap is the selected record that would be replaced first
+		auto heapOrder = [largest](const std::pair<std::uint64_t, std::size_t>& lhs, const std::pair<std::uint64_t, std::size_t>& rhs) {
+			return largest ? lhs < rhs : rhs < lhs;
+		};
+		std::vector<std::pair<std::uint64_t, std::size_t>> heap;
+		heap.reserve(count);
+		for (std::size_t row = 0; row < size(); ++row)
+		{
+			std::pair<std::uint64_t, std::size_t> entry{ sortKey(row, *ranks), row };
+			if (heap.size() < count)
+			{
+				heap.push_back(entry);
+				std::push_heap(heap.begin(), heap.end(), heapOrder);
+			}
+			else if (heapOrder(entry, heap.front()))
+			{
+				std::pop_heap(heap.begin(), heap.end(), heapOrder);
+				heap.back() = entry;
+				std::push_heap(heap.begin(), heap.end(), heapOrder);
+			}
+		}
+
+		std::sort(heap.begin(), heap.end());
+		std::vector<std::size_t> rows(heap.size());
+		std::transform(heap.begin(), heap.end(), rows.begin(), [](const auto& entry) { return entry.second; });
+		return rows;
+	}
+
+	// Put the records of 'rows' (in this order) to the rows starting at 'first', the records found
+	// there go to the rows left free. Only the moved records are buffered, the rest stays in place
+	void moveRowsTo(std::size_t first, const std::vector<std::size_t>& rows)
+	{
+		std::size_t count = rows.size();
+		std::vector<int> ages(count);
+		std::vector<NameId> nameIds(count);
+		std::vector<bool> isSelected(count);
+		std::vector<std::size_t> freeRows;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			ages[i] = ages_[rows[i]];
+			nameIds[i] = nameIds_[rows[i]];
+			if (rows[i] >= first && rows[i] < first + count)
+				isSelected[rows[i] - first] = true;
+			else
+				freeRows.push_back(rows[i]);
+		}
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			if (!isSelected[i])
+			{
+				ages_[freeRows.back()] = ages_[first + i];
+				nameIds_[freeRows.back()] = nameIds_[first + i];
+				freeRows.pop_back();
+			}
+		}
+		std::copy(ages.begin(), ages.end(), ages_.begin() + first);
+		std::copy(nameIds.begin(), nameIds.end(), nameIds_.begin() + first);
+	}
+
+	std::vector<std::size_t> orderedRows() const
+	{
+		std::vector<std::size_t> rows(size());
+		std::iota(rows.begin(), rows.end(), 0);
+		return rows;
+	}
+
+	// All row numbers, the first 'count' of them are the largest records in the sorted order
+	std::vector<std::size_t> frontSortedRows(std::size_t count) const
+	{
+		std::vector<std::uint64_t> keys = sortKeys();
+		std::vector<std::size_t> rows = orderedRows();
+		SelectFront(rows.begin(), rows.end(), count, [&](std::size_t lhs, std::size_t rhs) {
+			return keys[lhs] < keys[rhs];
+		});
+		return rows;
+	}
+
+	PersonTable gather(const std::vector<std::size_t>& rows) const
+	{
+		PersonTable result;
+		result.reserve(rows.size());
+		for (std::size_t row : rows)
+		{
+			result.push_back(ages_[row], nameIds_[row]);
+		}
+		return result;
+	}
+
+	std::vector<int> ages_;
+	std::vector<NameId> nameIds_;
+};
+
+#endif	// PERSON_TABLE_HPP
@@ -0,0 +1,246 @@
+#ifndef PIPELINE_HPP
+#define	PIPELINE_HPP
+
+#include "Person.hpp"
+#include "PersonTable.hpp"
+#include "TopK.hpp"
+#include "Parallel.hpp"
+#include "ZipView.hpp"
+#include <vector>
+#include <array>
+#include <string>
+#include <span>
+#include <random>
+#include <algorithm>
+#include <list>
+#include <memory_resource>
+#include <iterator>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+// The ages and names the pipeline records are drawn from, with the filler and the comparator
+// of the records (main.cpp and benchmark.cpp both take them from here)
+class PipelineRecords
+{
+public:
+	static constexpr int maxNumber = 7;
+
+	PipelineRecords() : nameIds_(internNames(names_)), nameOrder_(NameDictionary::instance().getOrder()) {}
+
+	std::span<const int> ages() const { return ages_; }
+	std::span<const std::string> names() const { return names_; }
+
+	// The filler takes the generator, so each thread can give it its own RNG stream
+	auto getFiller() const
+	{
+		return [this](std::mt19937& gen) -> Person {
+			std::uniform_int_distribution<std::mt19937::result_type> indexGenerator(0, maxNumber - 1);
+			return { ages_[indexGenerator(gen)], nameIds_[indexGenerator(gen)] };
+		};
+	}
+
+	// From the largest to the smallest comparator:
+	// by age in descending order (from 100 to 0) and by name in ascending order (from "A" to "Z")
+	auto getComparator() const
+	{
+		return [this](const Person& lhs, const Person& rhs) {
+			if (lhs.getAge() == rhs.getAge())
+				return nameOrder_(lhs.getNameId(), rhs.getNameId());	// integer comparison of the ids or ranks
+			return lhs.getAge() > rhs.getAge();
+		};
+	}
+
+private:
+	// Register the names up front, so their ids are in the lexicographic order
+	static std::array<Person::NameId, maxNumber> internNames(const std::array<std::string, maxNumber>& names)
+	{
+		NameDictionary& dictionary = NameDictionary::instance();
+		dictionary.internAll(names);
+		std::array<Person::NameId, maxNumber> nameIds;
+		std::transform(names.begin(), names.end(), nameIds.begin(), [&](const std::string& name) {
+			return dictionary.intern(name);
+		});
+		return nameIds;
+	}
+
+	std::array<int, maxNumber> ages_{ 18, 19, 20, 21, 22, 23, 24 };
+	std::array<std::string, maxNumber> names_{ "John", "Bob", "Maria", "William", "Kate", "Julia", "Robert" };
+	std::array<Person::NameId, maxNumber> nameIds_;
+	NameDictionary::Order nameOrder_;		// taken after the names are registered
+};
+
+struct PipelineResult {
+	std::size_t list3Size = 0;
+	std::size_t vectPairsSize = 0;
+	std::uint64_t checksum = 0;		// of the ages of all pairs, so the pairs are really visited
+};
+
+// The steps of the pipeline on 'v1Size' generated records, 'v2Size' of them copied to v2 and
+// 'listSize' moved to each list. Every step runs as 'stage(name, recordCount, func)', so the caller
+// can time it (main.cpp just calls 'func', benchmark.cpp reports the time of every stage)
+template<typename Filler, typename Compare, typename Stage>
+PipelineResult RunPipeline(std::size_t v1Size, std::size_t v2Size, std::size_t listSize, std::mt19937& gen,
+	std::mt19937::result_type seed, bool parallel, Filler filler, Compare comparator, Stage stage)
+{
+	// 1) Fill in v1 vector
+	//	(the filler takes the generator, so each thread can give it its own RNG stream)
+	std::vector<Person> v1(v1Size);
+	stage("generate", v1Size, [&]() {
+		if (parallel)
+			ParallelGenerate(v1.begin(), v1.end(), seed, filler);
+		else
+			std::generate(v1.begin(), v1.end(), [&]() { return filler(gen); });
+	});
+
+	// 2) Create v2 vector and copy the last 'v2Size' elements from v1
+	std::vector<Person> v2(v2Size);
+	stage("copy", v2Size, [&]() {
+		if (parallel)
+			ParallelCopy(v1.end() - v2Size, v1.end(), v2.begin());
+		else
+			std::copy(v1.end() - v2Size, v1.end(), v2.begin());
+	});
+
+	// All list nodes are taken from one pool (and reused after erase/remove_if)
+	// instead of a separate heap allocation per node
+	std::pmr::unsynchronized_pool_resource listNodePool;
+	std::pmr::list<Person> list1(&listNodePool), list2(&listNodePool);
+
+	// 3) Create list1 with the first 'listSize' largest elements from v1
+	//	(only these elements get sorted, they are put to the front of v1 and moved from there)
+	stage("top-k", v1.size(), [&]() {
+		auto list1End = parallel ? ParallelSelectFront(v1.begin(), v1.end(), listSize, comparator)
+			: SelectFront(v1.begin(), v1.end(), listSize, comparator);
+		list1.assign(std::make_move_iterator(v1.begin()), std::make_move_iterator(list1End));
+	});
+
+	// 4) Create list2 with the last 'listSize' smallest elements from v2
+	//	(only these elements get sorted, they are put to the back of v2 and moved from there)
+	stage("bottom-k", v2.size(), [&]() {
+		auto list2Begin = parallel ? ParallelSelectBack(v2.begin(), v2.end(), listSize, comparator)
+			: SelectBack(v2.begin(), v2.end(), listSize, comparator);
+		list2.assign(std::make_move_iterator(list2Begin), std::make_move_iterator(v2.end()));
+	});
+
+	// 5) Remove from v1 and v2 elements that were moved (the rest of v1 and v2 is not sorted)
+	stage("erase", v1.size() + v2.size() - list1.size() - list2.size(), [&]() {
+		v1.erase(v1.begin(), v1.begin() + list1.size());
+		v2.erase(v2.end() - list2.size(), v2.end());
+	});
+
+	// 6) For list1, find element with the "average" value (don't use strings because there is no
+	//	"average" string) and rearrange list1 (simple sorting would work)
+	stage("list sort", list1.size(), [&]() {
+		list1.sort([](const Person& lhs, const Person& rhs) {
+			return lhs.getAge() > rhs.getAge();
+		});
+	});
+
+	// 7) Remove odd elements from list2
+	stage("remove_if", list2.size(), [&]() {
+		int curElem = 0;
+		list2.remove_if([&](const Person&) {
+			return (curElem++) % 2 == 1;
+		});
+	});
+
+	// 8) Create v3 vector from v1 and v2
+	std::vector<Person> v3;
+	stage("concat", v1.size() + v2.size(), [&]() {
+		v3.resize(v1.size() + v2.size());
+		if (parallel)
+		{
+			ParallelCopy(v1.begin(), v1.end(), v3.begin());
+			ParallelCopy(v2.begin(), v2.end(), v3.begin() + v1.size());
+		}
+		else
+		{
+			std::copy(v1.begin(), v1.end(), v3.begin());
+			std::copy(v2.begin(), v2.end(), v3.begin() + v1.size());
+		}
+	});
+
+	// 9) Create list3 from list1 and list2
+	//	(the pairs are taken from the last elements of both lists: the unnecessary elements at
+	//	the beginning of the larger list are skipped by an offset instead of being erased)
+	// 10) Create a vector of pairs of v1 and v2 elements
+	//	(the pairs are consumed in place, see ZipView::materialize for a container of them)
+	PipelineResult result;
+	std::vector<Person>& smallerVect = (v1.size() > v2.size()) ? v2 : v1;
+	std::vector<Person>& largerVect = (v1.size() > v2.size()) ? v1 : v2;
+	stage("zip", std::min(list1.size(), list2.size()) + smallerVect.size(), [&]() {
+		auto list3 = ZipTail(list1, list2);
+		auto vectPairs = Zip(smallerVect, largerVect);
+		result = { list3.size(), vectPairs.size() };
+		for (auto [first, second] : list3)
+			result.checksum += first.getAge() * 31 + second.getAge();
+		for (auto [first, second] : vectPairs)
+			result.checksum += first.getAge() * 31 + second.getAge();
+	});
+	return result;
+}
+
+// Steps 1-5, 8 and 10 of the pipeline done on the columns of PersonTable, with the same sizes and
+// stages as RunPipeline (the lists are built from the selected rows, steps 6, 7 and 9 are left out)
+template<typename Stage>
+PipelineResult RunColumnarPipeline(std::size_t v1Size, std::size_t v2Size, std::size_t listSize, std::mt19937& gen,
+	const PipelineRecords& records, Stage stage)
+{
+	// 1) Fill in v1 table
+	PersonTable v1;
+	stage("generate", v1Size, [&]() {
+		v1 = PersonTable::generate(v1Size, records.ages(), records.names(), gen);
+	});
+
+	// 2) Create v2 table from the last 'v2Size' rows of v1
+	PersonTable v2;
+	stage("copy", v2Size, [&]() {
+		v2 = v1.slice(v1.size() - v2Size, v1.size());
+	});
+
+	std::pmr::unsynchronized_pool_resource listNodePool;
+	std::pmr::list<Person> list1(&listNodePool), list2(&listNodePool);
+
+	// 3) Create list1 with the first 'listSize' largest rows from v1
+	stage("top-k", v1.size(), [&]() {
+		v1.partialSort(listSize);
+		for (std::size_t row = 0; row < std::min(listSize, v1.size()); ++row)
+			list1.push_back(v1.getPerson(row));
+	});
+
+	// 4) Create list2 with the last 'listSize' smallest rows from v2
+	stage("bottom-k", v2.size(), [&]() {
+		v2.partialSortBack(listSize);
+		for (std::size_t row = v2.size() - std::min(listSize, v2.size()); row < v2.size(); ++row)
+			list2.push_back(v2.getPerson(row));
+	});
+
+	// 5) Remove from v1 and v2 rows that were copied
+	stage("erase", v1.size() + v2.size() - list1.size() - list2.size(), [&]() {
+		v1.eraseRange(0, list1.size());
+		v2.eraseRange(v2.size() - list2.size(), v2.size());
+	});
+
+	// 8) Create v3 table from v1 and v2
+	PersonTable v3;
+	stage("concat", v1.size() + v2.size(), [&]() {
+		v3.reserve(v1.size() + v2.size());
+		v3.append(v1);
+		v3.append(v2);
+	});
+
+	// 10) Pair the rows of v1 and v2 (consumed in place, as in RunPipeline)
+	PipelineResult result;
+	std::span<const int> smallerAges = (v1.size() > v2.size()) ? v2.ages() : v1.ages();
+	std::span<const int> largerAges = (v1.size() > v2.size()) ? v1.ages() : v2.ages();
+	stage("zip", smallerAges.size(), [&]() {
+		auto vectPairs = Zip(smallerAges, largerAges);
+		result.vectPairsSize = vectPairs.size();
+		for (auto [first, second] : vectPairs)
+			result.checksum += first * 31 + second;
+	});
+	return result;
+}
+
+#endif	// PIPELINE_HPP
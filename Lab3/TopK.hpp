@@ -0,0 +1,38 @@
+#ifndef TOP_K_HPP
+#define	TOP_K_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <cstddef>
+
+// Partial selection instead of a full sort: only the 'k' selected elements get ordered,
+// so the cost is O(n + k log k) rather than O(n log n). The order of the rest is unspecified.
+
+// Rearrange [first, last) so that its 'k' first elements in 'comp' order are at the front
+// and sorted. Returns the end of the selected part
+template<typename RandomIt, typename Compare>
+RandomIt SelectFront(RandomIt first, RandomIt last, std::size_t k, Compare comp)
+{
+	auto count = std::min<std::size_t>(k, std::distance(first, last));
+	RandomIt middle = first + count;
+	std::nth_element(first, middle, last, comp);
+	std::sort(first, middle, comp);
+	return middle;
+}
+
+// Rearrange [first, last) so that its 'k' last elements in 'comp' order are at the back
+// and sorted. Returns the beginning of the selected part
+template<typename RandomIt, typename Compare>
+RandomIt SelectBack(RandomIt first, RandomIt last, std::size_t k, Compare comp)
+{
+	auto count = std::min<std::size_t>(k, std::distance(first, last));
+	RandomIt middle = last - count;
+	if (middle != first)	// with k == size everything is selected, the sort alone is enough
+	{
+		std::nth_element(first, middle, last, comp);
+	}
+	std::sort(middle, last, comp);
+	return middle;
+}
+
+#endif	// TOP_K_HPP
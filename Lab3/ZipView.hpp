@@ -0,0 +1,91 @@
+#ifndef ZIP_VIEW_HPP
+#define	ZIP_VIEW_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+// Lazy pairing of two sequences: yields pairs of references to the elements, nothing is copied.
+// The view does not own the sequences, they must outlive it and must not be resized meanwhile
+template<typename FirstIt, typename SecondIt>
+class ZipView {
+public:
+	class Iterator {
+	public:
+		using iterator_category = std::input_iterator_tag;
+		using difference_type = std::ptrdiff_t;
+		using value_type = std::pair<typename std::iterator_traits<FirstIt>::reference,
+			typename std::iterator_traits<SecondIt>::reference>;
+		using reference = value_type;
+
+		Iterator() = default;
+		Iterator(FirstIt first, SecondIt second) : first_(first), second_(second) {}
+
+		reference operator*() const { return { *first_, *second_ }; }
+
+		Iterator& operator++()
+		{
+			++first_;
+			++second_;
+			return *this;
+		}
+		Iterator operator++(int)
+		{
+			Iterator old = *this;
+			++*this;
+			return old;
+		}
+
+		// Both sequences move together, so comparing one of them is enough
+		bool operator==(const Iterator& other) const { return first_ == other.first_; }
+
+	private:
+		FirstIt first_;
+		SecondIt second_;
+	};
+
+	ZipView(FirstIt first, SecondIt second, std::size_t size)
+		: begin_(first, second), end_(std::next(first, size), std::next(second, size)), size_(size) {}
+
+	Iterator begin() const { return begin_; }
+	Iterator end() const { return end_; }
+	std::size_t size() const { return size_; }
+	bool empty() const { return size_ == 0; }
+
+	// Copy the pairs into a container (e.g. std::vector<std::pair<Person, Person>>) when they are really needed.
+	// An empty container may be passed to keep its allocator, e.g. a std::pmr::list on the pool of the lists
+	template<typename Container>
+	Container materialize(Container result = Container()) const
+	{
+		if constexpr (requires { result.reserve(size_); })
+			result.reserve(size_);
+		for (auto [first, second] : *this)
+			result.emplace_back(first, second);
+		return result;
+	}
+
+private:
+	Iterator begin_, end_;
+	std::size_t size_;
+};
+
+// Pair up the first elements of 'first' and 'second', as many as the shorter one has
+template<typename FirstRange, typename SecondRange>
+auto Zip(FirstRange& first, SecondRange& second)
+{
+	std::size_t size = std::min<std::size_t>(std::size(first), std::size(second));
+	return ZipView(std::begin(first), std::begin(second), size);
+}
+
+// Pair up the last elements of 'first' and 'second', as many as the shorter one has.
+// The same as erasing the extra elements from the front of the longer one, but by an offset
+template<typename FirstRange, typename SecondRange>
+auto ZipTail(FirstRange& first, SecondRange& second)
+{
+	std::size_t firstSize = std::size(first), secondSize = std::size(second);
+	std::size_t size = std::min(firstSize, secondSize);
+	return ZipView(std::next(std::begin(first), firstSize - size), std::next(std::begin(second), secondSize - size), size);
+}
+
+#endif	// ZIP_VIEW_HPP
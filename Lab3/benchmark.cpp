@@ -0,0 +1,149 @@
+#include "Person.hpp"
+#include "Pipeline.hpp"
+#include "PersonSort.hpp"
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <cstdint>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#ifdef _MSC_VER
+#pragma comment(lib, "psapi.lib")
+#endif
+#else
+#include <sys/resource.h>
+#endif
+
+// Usage: benchmark [--parallel] [--seed <number>] [--max-size <number>]
+//	Runs the pipeline of main.cpp (Pipeline.hpp) with a fixed seed for v1 sizes 10^3, 10^4, ... up to
+//	--max-size (10^8 by default) and reports the time and the throughput of every stage and the
+//	process peak memory, then the same for the columnar stages of PersonTable and the full sorts of v1
+//	(std::sort against the counting sorts)
+
+std::size_t GetPeakMemoryBytes()
+{
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS counters{};
+	GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+	return counters.PeakWorkingSetSize;
+#else
+	rusage usage{};
+	getrusage(RUSAGE_SELF, &usage);
+	return static_cast<std::size_t>(usage.ru_maxrss) * 1024;	// kilobytes on Linux, the peak since the process start
+#endif
+}
+
+template<typename Func>
+double MeasureMs(Func func)
+{
+	auto start = std::chrono::steady_clock::now();
+	func();
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void ReportStage(const char* stage, double ms, std::size_t records)
+{
+	double recordsPerSecond = (ms > 0.0) ? records / (ms / 1000.0) : 0.0;
+	std::cout << "  " << std::left << std::setw(10) << stage << std::right << std::fixed << std::setprecision(3)
+		<< std::setw(12) << ms << " ms" << std::setw(12) << std::setprecision(2) << recordsPerSecond / 1e6 << " M records/s\n";
+}
+
+// The full sorts of 'size' generated records: std::sort with the comparator (ParallelSort with --parallel)
+// against the counting sort by (age, name rank) of SortByAgeAndName and of PersonTable::sort
+void RunSortStages(const PipelineRecords& records, std::size_t size, std::mt19937::result_type seed, bool parallel)
+{
+	auto comparator = records.getComparator();
+	auto reportSorted = [&](bool isSorted) {
+		if (!isSorted)
+			std::cout << "  the records are not sorted!\n";
+	};
+
+	PersonTable table;
+	{
+		std::vector<Person> generated(size);
+		ParallelGenerate(generated.begin(), generated.end(), seed, records.getFiller());
+
+		std::vector<Person> sorted = generated;
+		ReportStage("std::sort", MeasureMs([&]() {
+			if (parallel)
+				ParallelSort(sorted.begin(), sorted.end(), comparator);
+			else
+				std::sort(sorted.begin(), sorted.end(), comparator);
+		}), size);
+		reportSorted(std::is_sorted(sorted.begin(), sorted.end(), comparator));
+
+		sorted = generated;
+		ReportStage("count sort", MeasureMs([&]() { SortByAgeAndName(sorted.begin(), sorted.end()); }), size);
+		reportSorted(std::is_sorted(sorted.begin(), sorted.end(), comparator));
+
+		table.reserve(size);
+		for (const Person& person : generated)
+			table.push_back(person.getAge(), person.getNameId());
+	}
+	ReportStage("table sort", MeasureMs([&]() { table.sort(); }), size);
+	bool isSorted = true;
+	for (std::size_t row = 1; row < table.size() && isSorted; ++row)
+		isSorted = !comparator(table.getPerson(row), table.getPerson(row - 1));
+	reportSorted(isSorted);
+}
+
+// One run of the pipeline on 'size' records of v1
+void RunSize(const PipelineRecords& records, std::size_t size, std::mt19937::result_type seed, bool parallel)
+{
+	// The proportions of main.cpp: v2 takes the last 200 records of v1, the lists take
+	// 50 records each (the largest list size of main.cpp), only v1 grows with 'size'
+	std::size_t v2Size = std::min<std::size_t>(200, size);
+	std::size_t listSize = std::min<std::size_t>(50, v2Size);
+
+	std::cout << "size " << size << (parallel ? " (parallel)" : "") << "\n";
+
+	auto timeStage = [](const char* stage, std::size_t records, auto&& func) {
+		ReportStage(stage, MeasureMs(func), records);
+	};
+	std::mt19937 gen(seed);
+	PipelineResult result = RunPipeline(size, v2Size, listSize, gen, seed, parallel, records.getFiller(), records.getComparator(), timeStage);
+
+	// ru_maxrss / PeakWorkingSetSize never go down: this is the peak of the process so far,
+	// i.e. of the largest size run until now, not of this size alone
+	std::cout << "  " << result.list3Size + result.vectPairsSize << " pairs (checksum " << result.checksum << "), process peak memory so far "
+		<< GetPeakMemoryBytes() / (1024 * 1024) << " MiB\n";
+
+	// The same vector stages on the columns of PersonTable (always sequential)
+	std::cout << "size " << size << " columnar\n";
+	gen.seed(seed);
+	PipelineResult tableResult = RunColumnarPipeline(size, v2Size, listSize, gen, records, timeStage);
+	std::cout << "  " << tableResult.vectPairsSize << " pairs (checksum " << tableResult.checksum << ")\n";
+
+	RunSortStages(records, size, seed, parallel);
+}
+
+int main(int argc, char* argv[])
+{
+	bool parallel = false;
+	std::mt19937::result_type seed = 42;
+	std::size_t maxSize = 100'000'000;
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--parallel")
+			parallel = true;
+		else if (arg == "--seed" && i + 1 < argc)
+			seed = std::stoul(argv[++i]);
+		else if (arg == "--max-size" && i + 1 < argc)
+			maxSize = std::stoull(argv[++i]);
+	}
+
+	PipelineRecords records;
+	for (std::size_t size = 1'000; size <= maxSize; size *= 10)
+	{
+		RunSize(records, size, seed, parallel);
+	}
+	return 0;
+}
@@ -0,0 +1,319 @@
+#ifndef COMPRESSED_MATRIX_2D_H
+#define COMPRESSED_MATRIX_2D_H
+
+#include "Matrix2D.hpp"
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <optional>
+#include <iostream>
+#include <cstdint>
+#include <cstring>
+
+// Encodings of the column indices of a row (the columns are ascending). The encoder gets the
+// previous column of the row (0 for the first one), the decoder yields the columns in order
+
+// 4 bytes per index, as in the usual CSR layout
+struct PlainIndexEncoding
+{
+	static constexpr std::size_t fixedSize = 4;
+
+	static void encode(std::vector<std::uint8_t>& bytes, int /*previousCol*/, int col)
+	{
+		std::uint32_t value = col;
+		bytes.insert(bytes.end(), reinterpret_cast<const std::uint8_t*>(&value), reinterpret_cast<const std::uint8_t*>(&value) + 4);
+	}
+
+	class Decoder
+	{
+	public:
+		explicit Decoder(const std::uint8_t* bytes) : bytes_(bytes) {}
+
+		int next()
+		{
+			std::uint32_t col;
+			std::memcpy(&col, bytes_, 4);
+			bytes_ += 4;
+			return col;
+		}
+
+	private:
+		const std::uint8_t* bytes_;
+	};
+};
+
+// 2 bytes per delta to the previous column, a larger delta is 0xFFFF followed by the 4-byte column
+struct Delta16IndexEncoding
+{
+	static constexpr std::size_t fixedSize = 0;
+	static constexpr std::uint16_t escape = 0xFFFF;
+
+	static void encode(std::vector<std::uint8_t>& bytes, int previousCol, int col)
+	{
+		std::uint32_t delta = col - previousCol;
+		if (delta < escape)
+		{
+			std::uint16_t shortDelta = delta;
+			bytes.insert(bytes.end(), reinterpret_cast<const std::uint8_t*>(&shortDelta), reinterpret_cast<const std::uint8_t*>(&shortDelta) + 2);
+		}
+		else
+		{
+			std::uint32_t value = col;
+			bytes.insert(bytes.end(), reinterpret_cast<const std::uint8_t*>(&escape), reinterpret_cast<const std::uint8_t*>(&escape) + 2);
+			bytes.insert(bytes.end(), reinterpret_cast<const std::uint8_t*>(&value), reinterpret_cast<const std::uint8_t*>(&value) + 4);
+		}
+	}
+
+	class Decoder
+	{
+	public:
+		explicit Decoder(const std::uint8_t* bytes) : bytes_(bytes) {}
+
+		int next()
+		{
+			std::uint16_t delta;
+			std::memcpy(&delta, bytes_, 2);
+			bytes_ += 2;
+			if (delta != escape)
+			{
+				col_ += delta;
+			}
+			else
+			{
+				std::uint32_t col;
+				std::memcpy(&col, bytes_, 4);
+				bytes_ += 4;
+				col_ = col;
+			}
+			return col_;
+		}
+
+	private:
+		const std::uint8_t* bytes_;
+		int col_ = 0;
+	};
+};
+
+// Delta to the previous column in 7-bit groups (LEB128): 1 byte for deltas below 128
+struct VarintIndexEncoding
+{
+	static constexpr std::size_t fixedSize = 0;
+
+	static void encode(std::vector<std::uint8_t>& bytes, int previousCol, int col)
+	{
+		std::uint32_t delta = col - previousCol;
+		while (delta >= 0x80)
+		{
+			bytes.push_back(static_cast<std::uint8_t>(delta | 0x80));
+			delta >>= 7;
+		}
+		bytes.push_back(static_cast<std::uint8_t>(delta));
+	}
+
+	class Decoder
+	{
+	public:
+		explicit Decoder(const std::uint8_t* bytes) : bytes_(bytes) {}
+
+		int next()
+		{
+			std::uint32_t delta = *bytes_++;
+			if (delta >= 0x80)		// the one-byte deltas are the common case
+			{
+				delta &= 0x7F;
+				for (int shift = 7; ; shift += 7)
+				{
+					std::uint8_t byte = *bytes_++;
+					delta |= static_cast<std::uint32_t>(byte & 0x7F) << shift;
+					if (byte < 0x80)
+					{
+						break;
+					}
+				}
+			}
+			col_ += delta;
+			return col_;
+		}
+
+	private:
+		const std::uint8_t* bytes_;
+		int col_ = 0;
+	};
+};
+
+// Read-only compressed sparse row (CSR) storage of a matrix: the values of every row in column order
+// (as 'Value', e.g. float to halve the value bytes) and their column indices in 'IndexEncoding'.
+// The indices are decoded on the fly by the multiplications, so fewer bytes are read per nonzero
+template<typename Value = double, typename IndexEncoding = PlainIndexEncoding>
+class CompressedMatrix2D
+{
+public:
+	explicit CompressedMatrix2D(const Matrix2D& matr) : CompressedMatrix2D(matr.getRowNumber(), matr.getColNumber())
+	{
+		std::vector<std::vector<std::pair<int, double>>> rows(rowNumber_);
+		for (auto iter = matr.IterCbegin(); iter != matr.IterCend(); iter++)
+		{
+			auto [row, col] = iter->first;
+			rows[row].emplace_back(col, iter->second);
+		}
+		for (auto& row : rows)
+		{
+			std::sort(row.begin(), row.end());
+			appendRow(row);
+		}
+	}
+
+	int getRowNumber() const noexcept { return rowNumber_; }
+	int getColNumber() const noexcept { return colNumber_; }
+	std::size_t getNonZeroNumber() const noexcept { return values_.size(); }
+
+	// All the bytes of the layout: values, encoded indices and row offsets
+	std::size_t getByteSize() const noexcept
+	{
+		return values_.size() * sizeof(Value) + indexBytes_.size()
+			+ (rowStarts_.size() + indexStarts_.size()) * sizeof(std::uint32_t);
+	}
+
+	// Call 'func(col, value)' for the nonzero elements of the row in column order
+	template<typename Func>
+	void forEachInRow(int row, Func func) const
+	{
+		typename IndexEncoding::Decoder decoder(indexBytes_.data() + getIndexStart(row));
+		for (std::uint32_t k = rowStarts_[row]; k < rowStarts_[row + 1]; ++k)
+		{
+			func(decoder.next(), values_[k]);
+		}
+	}
+
+	Matrix2D toMatrix2D() const
+	{
+		Matrix2D result(rowNumber_, colNumber_);
+		for (int row = 0; row < rowNumber_; ++row)
+		{
+			forEachInRow(row, [&](int col, Value value) { result.setValueAt(row, col, value); });
+		}
+		return result;
+	}
+
+	// Multiplication with a dense vector, the same as 'operator*(const Vector&, const Matrix2D&)'
+	friend std::optional<std::vector<double>> operator*(const std::vector<double>& v, const CompressedMatrix2D& matr)
+	{
+		if (v.size() != static_cast<std::size_t>(matr.rowNumber_))
+		{
+			std::cout << "Can't do multiplication of vector and matrix! Vector column number is not equal to matrix row number!\n";
+			return {};	// return an empty vector
+		}
+
+		std::vector<double> result(matr.colNumber_);
+		for (int row = 0; row < matr.rowNumber_; ++row)
+		{
+			double vectValue = v[row];
+			if (vectValue != 0.0)
+			{
+				matr.forEachInRow(row, [&](int col, Value value) { result[col] += vectValue * value; });
+			}
+		}
+		return result;
+	}
+
+	// Row by row multiplication of matrices (Gustavson): the rows of m2 picked by the nonzero
+	// elements of a row of m1 are summed up in a dense accumulator
+	friend std::optional<CompressedMatrix2D> operator*(const CompressedMatrix2D& m1, const CompressedMatrix2D& m2)
+	{
+		if (m1.colNumber_ != m2.rowNumber_)
+		{
+			std::cout << "Can't do multiplication of matrices! Different sizes!\n";
+			return {};	// return an empty matrix
+		}
+
+		CompressedMatrix2D result(m1.rowNumber_, m2.colNumber_);
+		std::vector<double> accumulator(m2.colNumber_);
+		std::vector<bool> isUsed(m2.colNumber_);
+		std::vector<int> usedCols;
+		std::vector<std::pair<int, double>> resultRow;
+
+		for (int row = 0; row < m1.rowNumber_; ++row)
+		{
+			m1.forEachInRow(row, [&](int m1Col, Value m1Value) {
+				m2.forEachInRow(m1Col, [&](int m2Col, Value m2Value) {
+					if (!isUsed[m2Col])
+					{
+						isUsed[m2Col] = true;
+						usedCols.push_back(m2Col);
+					}
+					accumulator[m2Col] += static_cast<double>(m1Value) * m2Value;
+				});
+			});
+
+			std::sort(usedCols.begin(), usedCols.end());
+			resultRow.clear();
+			for (int col : usedCols)
+			{
+				if (isNotEqualToZero(accumulator[col]))		// zero values are not stored
+				{
+					resultRow.emplace_back(col, accumulator[col]);
+				}
+				accumulator[col] = 0.0;
+				isUsed[col] = false;
+			}
+			usedCols.clear();
+			result.appendRow(resultRow);
+		}
+		return result;
+	}
+
+private:
+	CompressedMatrix2D(int rowNumber, int colNumber) : rowNumber_(rowNumber), colNumber_(colNumber)
+	{
+		rowStarts_.reserve(rowNumber + 1);
+		rowStarts_.push_back(0);
+		if constexpr (IndexEncoding::fixedSize == 0)
+		{
+			indexStarts_.reserve(rowNumber + 1);
+			indexStarts_.push_back(0);
+		}
+	}
+
+	// 'row' must be sorted by columns, the rows are appended in order
+	void appendRow(const std::vector<std::pair<int, double>>& row)
+	{
+		int previousCol = 0;
+		for (auto [col, value] : row)
+		{
+			IndexEncoding::encode(indexBytes_, previousCol, col);
+			values_.push_back(static_cast<Value>(value));
+			previousCol = col;
+		}
+		rowStarts_.push_back(values_.size());
+		if constexpr (IndexEncoding::fixedSize == 0)
+		{
+			indexStarts_.push_back(indexBytes_.size());
+		}
+	}
+
+	// A fixed size encoding needs no byte offsets of the rows
+	std::size_t getIndexStart(int row) const
+	{
+		if constexpr (IndexEncoding::fixedSize != 0)
+		{
+			return rowStarts_[row] * IndexEncoding::fixedSize;
+		}
+		else
+		{
+			return indexStarts_[row];
+		}
+	}
+
+	// Nonzero values, row after row
+	std::vector<Value> values_;
+	// Encoded column indices of the values
+	std::vector<std::uint8_t> indexBytes_;
+	// Position of the first value of every row (and the value number at the end)
+	std::vector<std::uint32_t> rowStarts_;
+	// Position of the first index byte of every row (only for variable size encodings)
+	std::vector<std::uint32_t> indexStarts_;
+	// Row and column sizes
+	int rowNumber_, colNumber_;
+};
+
+#endif	// COMPRESSED_MATRIX_2D_H
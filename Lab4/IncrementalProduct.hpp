@@ -0,0 +1,139 @@
+#ifndef INCREMENTAL_PRODUCT_H
+#define INCREMENTAL_PRODUCT_H
+
+#include "Matrix2D.hpp"
+#include "Vector.hpp"
+#include <unordered_map>
+#include <vector>
+#include <optional>
+#include <iostream>
+#include <cmath>
+#include <algorithm>
+
+// Cached result of 'v * M' that follows changes of single entries of the operands:
+// result[j] = sum of v[i] * M[i][j], so a change of v[i] by 'delta' adds delta * M[i][j]
+// to every result[j] of the row i, and a change of M[i][j] adds v[i] * delta to result[j].
+// An update costs the length of one matrix row (or O(1)) instead of a full multiplication
+class IncrementalProduct
+{
+public:
+	static std::optional<IncrementalProduct> create(const Vector& v, const Matrix2D& matr)
+	{
+		if (v.getColNumber() != matr.getRowNumber())
+		{
+			std::cout << "Can't do multiplication of vector and matrix! Vector column number is not equal to matrix row number!\n";
+			return {};
+		}
+		return IncrementalProduct(v, matr);
+	}
+
+	int getColNumber() const noexcept { return result_.size(); }
+
+	double getVectorValueAt(int index) const { return vector_[index]; }
+	double getMatrixValueAt(int x, int y) const
+	{
+		auto iter = rows_[x].find(y);
+		return iter != rows_[x].end() ? iter->second : 0.0;
+	}
+	double getResultAt(int index) const { return result_[index]; }
+
+	void setVectorValueAt(int index, double value)
+	{
+		double delta = value - vector_[index];
+		vector_[index] = value;
+		for (auto [col, matrValue] : rows_[index])
+		{
+			result_[col] += delta * matrValue;
+		}
+	}
+
+	void setMatrixValueAt(int x, int y, double value)
+	{	// zero values are not stored
+		double delta = value - getMatrixValueAt(x, y);
+		if (isNotEqualToZero(value))
+		{
+			rows_[x][y] = value;
+		}
+		else
+		{
+			rows_[x].erase(y);
+		}
+		result_[y] += vector_[x] * delta;
+	}
+
+	// The result without zero entries, as 'operator*' returns it
+	Vector getResult() const
+	{
+		Vector result(result_.size());
+		for (std::size_t i = 0; i < result_.size(); ++i)
+		{
+			result.setValueAt(i, result_[i]);
+		}
+		return result;
+	}
+
+	// Multiply the current operands from scratch, e.g. to drop the rounding errors of many updates
+	void recompute()
+	{
+		std::fill(result_.begin(), result_.end(), 0.0);
+		for (std::size_t row = 0; row < rows_.size(); ++row)
+		{
+			for (auto [col, matrValue] : rows_[row])
+			{
+				result_[col] += vector_[row] * matrValue;
+			}
+		}
+	}
+
+	// Check the cached result against the full 'operator*' of the current operands
+	bool verify() const
+	{
+		Vector v(vector_.size());
+		Matrix2D matr(rows_.size(), result_.size());
+		for (std::size_t row = 0; row < rows_.size(); ++row)
+		{
+			v.setValueAt(row, vector_[row]);
+			for (auto [col, matrValue] : rows_[row])
+			{
+				matr.setValueAt(row, col, matrValue);
+			}
+		}
+
+		Vector expected = (v * matr).value();
+		for (std::size_t i = 0; i < result_.size(); ++i)
+		{
+			double expectedValue = expected.isNotZero(i) ? expected.getValueAt(i) : 0.0;
+			if (isNotEqualToZero(expectedValue - result_[i]))
+			{
+				std::cout << "Incremental product differs at " << i << ": " << result_[i] << " instead of " << expectedValue << "\n";
+				return false;
+			}
+		}
+		return true;
+	}
+
+private:
+	IncrementalProduct(const Vector& v, const Matrix2D& matr)
+		: vector_(v.getColNumber()), rows_(matr.getRowNumber()), result_(matr.getColNumber())
+	{
+		for (auto iter = v.IterCbegin(); iter != v.IterCend(); iter++)
+		{
+			vector_[iter->first] = iter->second;
+		}
+		for (auto iter = matr.IterCbegin(); iter != matr.IterCend(); iter++)
+		{
+			auto [row, col] = iter->first;
+			rows_[row].emplace(col, iter->second);
+		}
+		recompute();
+	}
+
+	// Dense vector operand
+	std::vector<double> vector_;
+	// Matrix operand by rows: column-value pairs of every row
+	std::vector<std::unordered_map<int, double>> rows_;
+	// Dense cached result
+	std::vector<double> result_;
+};
+
+#endif	// INCREMENTAL_PRODUCT_H
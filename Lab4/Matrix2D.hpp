@@ -7,6 +7,7 @@
 #include <iostream>
 #include <optional>
 #include <cassert>
+#include <cmath>
 
 bool isNotEqualToZero(double val)
 {
@@ -62,6 +63,18 @@ public:
 		return hashTable_.at(std::pair(x, y));
 	}
 
+	void setValueAt(int x, int y, double value)
+	{	// zero values are not stored
+		if (isNotEqualToZero(value))
+		{
+			hashTable_[std::pair(x, y)] = value;
+		}
+		else
+		{
+			hashTable_.erase(std::pair(x, y));
+		}
+	}
+
 	auto IterBegin() { return hashTable_.begin(); }
 	auto IterEnd() { return hashTable_.begin(); }
 	auto IterCbegin() const { return hashTable_.cbegin(); }
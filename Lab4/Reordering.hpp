@@ -0,0 +1,237 @@
+#ifndef REORDERING_H
+#define REORDERING_H
+
+#include "Matrix2D.hpp"
+#include "Vector.hpp"
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <iostream>
+#include <cstdlib>
+
+// Symmetric permutation of matrix rows/columns (and vector entries):
+// new index 'k' takes the row/column that had the old index 'newToOld[k]'
+class Permutation
+{
+public:
+	explicit Permutation(const std::vector<int>& newToOld) : newToOld_(newToOld), oldToNew_(newToOld.size())
+	{
+		for (std::size_t k = 0; k < newToOld_.size(); ++k)
+		{
+			oldToNew_[newToOld_[k]] = k;
+		}
+	}
+
+	int getSize() const noexcept { return newToOld_.size(); }
+
+	int getOldIndex(int newIndex) const { return newToOld_[newIndex]; }
+	int getNewIndex(int oldIndex) const { return oldToNew_[oldIndex]; }
+
+	Permutation inverse() const { return Permutation(oldToNew_); }
+
+private:
+	std::vector<int> newToOld_;
+	std::vector<int> oldToNew_;
+};
+
+// Adjacency lists of the symmetrized sparsity pattern (A + A^T), without the diagonal
+std::vector<std::vector<int>> buildAdjacency(const Matrix2D& matr)
+{
+	std::vector<std::vector<int>> adjacency(matr.getRowNumber());
+	for (auto iter = matr.IterCbegin(); iter != matr.IterCend(); iter++)
+	{
+		auto [row, col] = iter->first;
+		if (row != col)
+		{
+			adjacency[row].push_back(col);
+			adjacency[col].push_back(row);
+		}
+	}
+
+	for (auto& neighbours : adjacency)
+	{	// an entry and its transposed one give the same edge twice
+		std::sort(neighbours.begin(), neighbours.end());
+		neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+	}
+	return adjacency;
+}
+
+// Breadth-first traversal from 'start' that visits neighbours in ascending degree order.
+// Appends visited vertices to 'order', stores the number of levels in 'levelCount'
+// and returns the index in 'order' where the last level starts
+std::size_t traverseByLevels(const std::vector<std::vector<int>>& adjacency, int start,
+	std::vector<bool>& visited, std::vector<int>& order, int& levelCount)
+{
+	std::vector<int> neighbours;
+	std::size_t levelBegin = order.size(), lastLevelStart = levelBegin;
+	order.push_back(start);
+	visited[start] = true;
+
+	levelCount = 0;
+	while (levelBegin < order.size())
+	{
+		std::size_t levelEnd = order.size();
+		lastLevelStart = levelBegin;
+		++levelCount;
+
+		for (std::size_t k = levelBegin; k < levelEnd; ++k)
+		{
+			neighbours.clear();
+			for (int neighbour : adjacency[order[k]])
+			{
+				if (!visited[neighbour])
+				{
+					visited[neighbour] = true;
+					neighbours.push_back(neighbour);
+				}
+			}
+			std::stable_sort(neighbours.begin(), neighbours.end(), [&](int lhs, int rhs) {
+				return adjacency[lhs].size() < adjacency[rhs].size();
+			});
+			order.insert(order.end(), neighbours.begin(), neighbours.end());
+		}
+		levelBegin = levelEnd;
+	}
+	return lastLevelStart;
+}
+
+// Pseudo-peripheral vertex of the component of 'start' (George-Liu heuristic):
+// keep jumping to the lowest degree vertex of the last level while the number of levels grows
+int findPeripheralVertex(const std::vector<std::vector<int>>& adjacency, int start)
+{
+	std::vector<bool> visited(adjacency.size());
+	std::vector<int> order;
+	int levelCount = 0;
+	std::size_t lastLevelStart = traverseByLevels(adjacency, start, visited, order, levelCount);
+
+	while (true)
+	{
+		int candidate = *std::min_element(order.begin() + lastLevelStart, order.end(), [&](int lhs, int rhs) {
+			return adjacency[lhs].size() < adjacency[rhs].size();
+		});
+
+		for (int vertex : order)	// reset only the current component
+		{
+			visited[vertex] = false;
+		}
+		order.clear();
+
+		int candidateLevelCount = 0;
+		lastLevelStart = traverseByLevels(adjacency, candidate, visited, order, candidateLevelCount);
+		if (candidateLevelCount <= levelCount)
+		{
+			return start;
+		}
+		start = candidate;
+		levelCount = candidateLevelCount;
+	}
+}
+
+// Reverse Cuthill-McKee ordering, reduces the bandwidth of the (symmetrized) matrix
+std::optional<Permutation> reverseCuthillMcKee(const Matrix2D& matr)
+{
+	if (matr.getRowNumber() != matr.getColNumber())
+	{
+		std::cout << "The matrix is not of square form! Can't do reordering!\n";
+		return {};
+	}
+
+	auto adjacency = buildAdjacency(matr);
+	int size = adjacency.size();
+
+	// Components are started from the lowest degree vertices
+	std::vector<int> byDegree(size);
+	std::iota(byDegree.begin(), byDegree.end(), 0);
+	std::stable_sort(byDegree.begin(), byDegree.end(), [&](int lhs, int rhs) {
+		return adjacency[lhs].size() < adjacency[rhs].size();
+	});
+
+	std::vector<bool> visited(size);
+	std::vector<int> order;
+	order.reserve(size);
+	for (int vertex : byDegree)
+	{
+		if (!visited[vertex])
+		{
+			int levelCount = 0;
+			traverseByLevels(adjacency, findPeripheralVertex(adjacency, vertex), visited, order, levelCount);
+		}
+	}
+
+	std::reverse(order.begin(), order.end());
+	return Permutation(order);
+}
+
+// Ascending degree ordering, a cheap alternative to RCM
+std::optional<Permutation> degreeOrdering(const Matrix2D& matr)
+{
+	if (matr.getRowNumber() != matr.getColNumber())
+	{
+		std::cout << "The matrix is not of square form! Can't do reordering!\n";
+		return {};
+	}
+
+	auto adjacency = buildAdjacency(matr);
+	std::vector<int> order(adjacency.size());
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(), [&](int lhs, int rhs) {
+		return adjacency[lhs].size() < adjacency[rhs].size();
+	});
+	return Permutation(order);
+}
+
+// The largest distance of a non-zero element from the main diagonal
+int getBandwidth(const Matrix2D& matr)
+{
+	int bandwidth = 0;
+	for (auto iter = matr.IterCbegin(); iter != matr.IterCend(); iter++)
+	{
+		auto [row, col] = iter->first;
+		bandwidth = std::max(bandwidth, std::abs(row - col));
+	}
+	return bandwidth;
+}
+
+// P * A * P^T - both rows and columns are reordered
+std::optional<Matrix2D> permute(const Matrix2D& matr, const Permutation& perm)
+{
+	if (matr.getRowNumber() != perm.getSize() || matr.getColNumber() != perm.getSize())
+	{
+		std::cout << "Can't do permutation of matrix! Different sizes!\n";
+		return {};
+	}
+
+	Matrix2D result(perm.getSize(), perm.getSize());
+	for (auto iter = matr.IterCbegin(); iter != matr.IterCend(); iter++)
+	{
+		auto [row, col] = iter->first;
+		result.setValueAt(perm.getNewIndex(row), perm.getNewIndex(col), iter->second);
+	}
+	return result;
+}
+
+// P * v, makes a vector match the matrix permuted by the same permutation
+std::optional<Vector> permute(const Vector& vect, const Permutation& perm)
+{
+	if (vect.getColNumber() != perm.getSize())
+	{
+		std::cout << "Can't do permutation of vector! Different sizes!\n";
+		return {};
+	}
+
+	Vector result(perm.getSize());
+	for (auto iter = vect.IterCbegin(); iter != vect.IterCend(); iter++)
+	{
+		result.setValueAt(perm.getNewIndex(iter->first), iter->second);
+	}
+	return result;
+}
+
+// P^T * v, brings a result computed in the permuted order back to the original one
+std::optional<Vector> unpermute(const Vector& vect, const Permutation& perm)
+{
+	return permute(vect, perm.inverse());
+}
+
+#endif	// REORDERING_H
@@ -29,6 +29,29 @@ public:
 	}
 
 	int getVectorSize() const { return hashTable_.size(); }
+	int getColNumber() const noexcept { return colNumber_; }
+
+	bool isNotZero(int index) const noexcept
+	{	// if such a value exists, then it's not a zero
+		return hashTable_.count(index) != 0;
+	}
+
+	double getValueAt(int index) const
+	{
+		return hashTable_.at(index);
+	}
+
+	void setValueAt(int index, double value)
+	{	// zero values are not stored
+		if (isNotEqualToZero(value))
+		{
+			hashTable_[index] = value;
+		}
+		else
+		{
+			hashTable_.erase(index);
+		}
+	}
 
 	auto IterBegin() { return hashTable_.begin(); }
 	auto IterEnd() { return hashTable_.begin(); }
@@ -168,13 +191,10 @@ std::optional<Vector> operator*(const Vector& v, const Matrix2D& matr)
 		}
 	}
 
-	for (int i = 0; i < result.hashTable_.size(); ++i)
-	{
-		if (!isNotEqualToZero(result.hashTable_.at(i)))	// if the value is zero
-		{
-			result.hashTable_.erase(i);
-		}
-	}	
+	// the result may have gaps in the indices, so go over the stored elements
+	std::erase_if(result.hashTable_, [](const auto& element) {
+		return !isNotEqualToZero(element.second);	// if the value is zero
+	});
 	return result;
 }
 
@@ -1,8 +1,14 @@
 #include "Vector.hpp"
 #include "Matrix2D.hpp"
+#include "Reordering.hpp"
+#include "IncrementalProduct.hpp"
+#include "CompressedMatrix2D.hpp"
 #include <iostream>
 #include <vector>
 #include <chrono>
+#include <random>
+#include <numeric>
+#include <algorithm>
 
 std::vector<double> stlVectorAddition(const std::vector<double>& v1, const std::vector<double>& v2)
 {
@@ -150,10 +156,214 @@ void testMatrix()
 	std::cout << "Custom time - " << customMatrixEnd - customMatrixStart << "\nStl time - " << stlMatrixEnd - stlMatrixStart << "\n";
 }
 
+void testReordering()
+{
+	constexpr int MATRIX_SIZE = 300, HALF_BAND = 2;
+
+	// Banded matrix with rows and columns shuffled - irregular access pattern
+	std::vector<int> shuffled(MATRIX_SIZE);
+	std::iota(shuffled.begin(), shuffled.end(), 0);
+	std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(42));
+
+	std::vector<std::vector<double>> m(MATRIX_SIZE, std::vector<double>(MATRIX_SIZE));
+	for (int i = 0; i < MATRIX_SIZE; ++i)
+	{
+		for (int j = std::max(0, i - HALF_BAND); j <= std::min(MATRIX_SIZE - 1, i + HALF_BAND); ++j)
+		{
+			m[shuffled[i]][shuffled[j]] = 1.0;
+		}
+	}
+
+	Matrix2D matr(m);
+	Vector vect(std::vector<double>(MATRIX_SIZE, 1.0));
+
+	auto reorderStart = std::chrono::high_resolution_clock::now();
+
+	Permutation perm = reverseCuthillMcKee(matr).value();
+	Matrix2D reorderedMatr = permute(matr, perm).value();
+	Vector reorderedVect = permute(vect, perm).value();
+
+	auto reorderEnd = std::chrono::high_resolution_clock::now();
+
+	std::cout << "Bandwidth - " << getBandwidth(matr) << " -> " << getBandwidth(reorderedMatr) << "\n";
+
+	auto originalStart = std::chrono::high_resolution_clock::now();
+	Vector originalResult = (vect * matr).value();
+	auto originalEnd = std::chrono::high_resolution_clock::now();
+
+	auto reorderedStart = std::chrono::high_resolution_clock::now();
+	Vector reorderedResult = unpermute((reorderedVect * reorderedMatr).value(), perm).value();
+	auto reorderedEnd = std::chrono::high_resolution_clock::now();
+
+	double maxDelta = 0.0;
+	for (int i = 0; i < MATRIX_SIZE; ++i)
+	{
+		double lhs = originalResult.isNotZero(i) ? originalResult.getValueAt(i) : 0.0;
+		double rhs = reorderedResult.isNotZero(i) ? reorderedResult.getValueAt(i) : 0.0;
+		maxDelta = std::max(maxDelta, std::abs(lhs - rhs));
+	}
+	std::cout << "Max delta of results - " << maxDelta << "\n";
+
+	std::cout << "Reordering time - " << reorderEnd - reorderStart << "\nOriginal time - " << originalEnd - originalStart
+		<< "\nReordered time - " << reorderedEnd - reorderedStart << "\n";
+}
+
+void testIncrementalProduct()
+{
+	constexpr int MATRIX_SIZE = 300, ROW_LENGTH = 5, UPDATE_NUMBER = 1000;
+
+	std::mt19937 gen(42);
+	std::uniform_int_distribution<int> indexGenerator(0, MATRIX_SIZE - 1);
+	std::uniform_real_distribution<double> valueGenerator(-1.0, 1.0);
+
+	std::vector<std::vector<double>> m(MATRIX_SIZE, std::vector<double>(MATRIX_SIZE));
+	std::vector<double> v(MATRIX_SIZE);
+	for (int i = 0; i < MATRIX_SIZE; ++i)
+	{
+		for (int k = 0; k < ROW_LENGTH; ++k)
+		{
+			m[i][indexGenerator(gen)] = valueGenerator(gen);
+		}
+		v[i] = valueGenerator(gen);
+	}
+
+	Matrix2D matr(m);
+	Vector vect(v);
+	IncrementalProduct product = IncrementalProduct::create(vect, matr).value();
+
+	// Every update changes one entry of the vector or of the matrix, then the result is taken
+	auto incrementalStart = std::chrono::high_resolution_clock::now();
+	for (int i = 0; i < UPDATE_NUMBER; ++i)
+	{
+		if (i % 2 == 0)
+		{
+			product.setVectorValueAt(indexGenerator(gen), valueGenerator(gen));
+		}
+		else
+		{
+			product.setMatrixValueAt(indexGenerator(gen), indexGenerator(gen), valueGenerator(gen));
+		}
+	}
+	Vector incrementalResult = product.getResult();
+	auto incrementalEnd = std::chrono::high_resolution_clock::now();
+
+	// One multiplication from scratch, the cost of every update without the incremental product
+	auto fullStart = std::chrono::high_resolution_clock::now();
+	Vector fullResult = (vect * matr).value();
+	auto fullEnd = std::chrono::high_resolution_clock::now();
+
+	std::cout << "Incremental product is " << (product.verify() ? "consistent" : "NOT consistent") << " after " << UPDATE_NUMBER << " updates\n";
+	std::cout << "Incremental time (" << UPDATE_NUMBER << " updates) - " << incrementalEnd - incrementalStart
+		<< "\nFull time (1 multiplication) - " << fullEnd - fullStart << "\n";
+}
+
+// The multiplication with a dense vector over the hash table (without the nonzero
+// elements of the vector found one by one, as 'operator*(const Vector&, const Matrix2D&)' does)
+std::vector<double> hashMatrixProduct(const std::vector<double>& v, const Matrix2D& matr)
+{
+	std::vector<double> result(matr.getColNumber());
+	for (auto iter = matr.IterCbegin(); iter != matr.IterCend(); iter++)
+	{
+		auto [row, col] = iter->first;
+		result[col] += v[row] * iter->second;
+	}
+	return result;
+}
+
+double getMaxDelta(const std::vector<double>& lhs, const std::vector<double>& rhs)
+{
+	double maxDelta = 0.0;
+	for (std::size_t i = 0; i < lhs.size(); ++i)
+	{
+		maxDelta = std::max(maxDelta, std::abs(lhs[i] - rhs[i]));
+	}
+	return maxDelta;
+}
+
+// Bytes per nonzero element, the time of the vector product and of squaring the (smaller) matrix
+template<typename Matrix>
+void reportCompressedMatrix(const char* name, const Matrix& matr, const Matrix& smallMatr, const std::vector<double>& v,
+	const std::vector<double>& expected, int repeatNumber)
+{
+	std::vector<double> result;
+	auto productStart = std::chrono::high_resolution_clock::now();
+	for (int i = 0; i < repeatNumber; ++i)
+	{
+		result = (v * matr).value();
+	}
+	auto productEnd = std::chrono::high_resolution_clock::now();
+
+	auto squareStart = std::chrono::high_resolution_clock::now();
+	Matrix square = (smallMatr * smallMatr).value();
+	auto squareEnd = std::chrono::high_resolution_clock::now();
+
+	std::cout << name << " - " << static_cast<double>(matr.getByteSize()) / matr.getNonZeroNumber() << " bytes/nnz, product time "
+		<< (productEnd - productStart) / repeatNumber << ", square time " << squareEnd - squareStart
+		<< " (" << square.getNonZeroNumber() << " nnz), max delta " << getMaxDelta(result, expected) << "\n";
+}
+
+void testCompressedMatrix()
+{
+	constexpr int MATRIX_SIZE = 20000, SMALL_MATRIX_SIZE = 2000, ROW_LENGTH = 16, NEAR_DISTANCE = 200, REPEAT_NUMBER = 20;
+
+	// Most of the elements are near the diagonal (small column deltas), every eighth one is anywhere
+	std::mt19937 gen(42);
+	std::uniform_real_distribution<double> valueGenerator(-1.0, 1.0);
+	auto makeMatrix = [&](int size) {
+		std::uniform_int_distribution<int> nearGenerator(-NEAR_DISTANCE, NEAR_DISTANCE), farGenerator(0, size - 1);
+		Matrix2D matr(size, size);
+		for (int i = 0; i < size; ++i)
+		{
+			for (int k = 0; k < ROW_LENGTH; ++k)
+			{
+				int col = (k % 8 == 0) ? farGenerator(gen) : std::clamp(i + nearGenerator(gen), 0, size - 1);
+				matr.setValueAt(i, col, valueGenerator(gen));
+			}
+		}
+		return matr;
+	};
+	Matrix2D matr = makeMatrix(MATRIX_SIZE);
+	Matrix2D smallMatr = makeMatrix(SMALL_MATRIX_SIZE);
+
+	std::vector<double> v(MATRIX_SIZE);
+	for (double& value : v)
+	{
+		value = valueGenerator(gen);
+	}
+
+	// The hash table: a node of the key-value pair and the next pointer per element (buckets not counted)
+	std::size_t nonZeroNumber = std::distance(matr.IterCbegin(), matr.IterCend());
+	std::vector<double> expected;
+	auto hashStart = std::chrono::high_resolution_clock::now();
+	for (int i = 0; i < REPEAT_NUMBER; ++i)
+	{
+		expected = hashMatrixProduct(v, matr);
+	}
+	auto hashEnd = std::chrono::high_resolution_clock::now();
+	std::cout << "Hash Matrix2D - at least " << sizeof(void*) + sizeof(std::pair<const std::pair<int, int>, double>)
+		<< " bytes/nnz, product time " << (hashEnd - hashStart) / REPEAT_NUMBER << " (" << nonZeroNumber << " nnz)\n";
+
+	reportCompressedMatrix("CSR double, int32 indices", CompressedMatrix2D<double, PlainIndexEncoding>(matr),
+		CompressedMatrix2D<double, PlainIndexEncoding>(smallMatr), v, expected, REPEAT_NUMBER);
+	reportCompressedMatrix("CSR double, 16-bit deltas", CompressedMatrix2D<double, Delta16IndexEncoding>(matr),
+		CompressedMatrix2D<double, Delta16IndexEncoding>(smallMatr), v, expected, REPEAT_NUMBER);
+	reportCompressedMatrix("CSR double, varint deltas", CompressedMatrix2D<double, VarintIndexEncoding>(matr),
+		CompressedMatrix2D<double, VarintIndexEncoding>(smallMatr), v, expected, REPEAT_NUMBER);
+	reportCompressedMatrix("CSR float, int32 indices", CompressedMatrix2D<float, PlainIndexEncoding>(matr),
+		CompressedMatrix2D<float, PlainIndexEncoding>(smallMatr), v, expected, REPEAT_NUMBER);
+	reportCompressedMatrix("CSR float, 16-bit deltas", CompressedMatrix2D<float, Delta16IndexEncoding>(matr),
+		CompressedMatrix2D<float, Delta16IndexEncoding>(smallMatr), v, expected, REPEAT_NUMBER);
+	reportCompressedMatrix("CSR float, varint deltas", CompressedMatrix2D<float, VarintIndexEncoding>(matr),
+		CompressedMatrix2D<float, VarintIndexEncoding>(smallMatr), v, expected, REPEAT_NUMBER);
+}
+
 int main()
 {
 	//testVector();
 	testMatrix();
+	testReordering();
+	testIncrementalProduct();
+	testCompressedMatrix();
 	
 	return 0;
 }
\ No newline at end of file